@@ -459,8 +459,19 @@ int App::processConverter(const CommandLineParser::ConverterTask& task)
     bool forceMode = task.params[CommandLineParser::ParamKey::ForceMode].toBool();
 
     switch (task.type) {
-    case CommandLineParser::ConvertType::Batch:
-        ret = converter()->batchConvert(task.inputFile, stylePath, forceMode);
+    case CommandLineParser::ConvertType::Batch: {
+        converter::BatchConvertOptions options;
+        options.jobs = task.params.value(CommandLineParser::ParamKey::BatchJobs, 1).toInt();
+        options.continueOnError = task.params[CommandLineParser::ParamKey::BatchContinueOnError].toBool();
+        options.reportPath = task.params[CommandLineParser::ParamKey::BatchReportPath].toString();
+        for (const QString& arg : task.params[CommandLineParser::ParamKey::BatchWorkerArguments].toStringList()) {
+            options.workerArguments.push_back(arg.toStdString());
+        }
+
+        ret = converter()->batchConvert(task.inputFile, stylePath, forceMode, options);
+    } break;
+    case CommandLineParser::ConvertType::Daemon:
+        ret = converter()->runDaemon(stylePath, forceMode);
         break;
     case CommandLineParser::ConvertType::ConvertScoreParts:
         ret = converter()->convertScoreParts(task.inputFile, task.outputFile, stylePath);
@@ -82,6 +82,13 @@ void CommandLineParser::init()
     // Converter mode
     m_parser.addOption(QCommandLineOption({ "r", "image-resolution" }, "Set output resolution for image export", "DPI"));
     m_parser.addOption(QCommandLineOption({ "j", "job" }, "Process a conversion job", "file"));
+    m_parser.addOption(QCommandLineOption("jobs", "Use with '-j <file>', convert up to N jobs in parallel, each in a separate process, "
+                                          "the exit code is the one of the first failed job", "N"));
+    m_parser.addOption(QCommandLineOption("continue-on-error", "Use with '-j <file>', do not stop the batch at the first failed job"));
+    m_parser.addOption(QCommandLineOption("job-report", "Use with '-j <file>', write a per-job result report (JSON) to 'file', "
+                                          "the code of a job is the exit code of converting it alone", "file"));
+    m_parser.addOption(QCommandLineOption("converter-daemon",
+                                          "Keep running and process conversion jobs read from stdin, one JSON object per line"));
     m_parser.addOption(QCommandLineOption({ "o", "export-to" }, "Export to 'file'. Format depends on file's extension", "file"));
     m_parser.addOption(QCommandLineOption({ "F", "factory-settings" }, "Use factory settings"));
     m_parser.addOption(QCommandLineOption({ "R", "revert-settings" }, "Revert to factory settings, but keep default preferences"));
@@ -293,6 +300,44 @@ void CommandLineParser::parse(int argc, char** argv)
         m_runMode = IApplication::RunMode::ConsoleApp;
         m_converterTask.type = ConvertType::Batch;
         m_converterTask.inputFile = fromUserInputPath(m_parser.value("j"));
+
+        if (m_parser.isSet("jobs")) {
+            std::optional<int> val = intValue("jobs");
+            if (val && val.value() > 0) {
+                m_converterTask.params[CommandLineParser::ParamKey::BatchJobs] = val.value();
+            } else {
+                LOGE() << "Option: --jobs not recognized value: " << m_parser.value("jobs");
+            }
+        }
+
+        if (m_parser.isSet("continue-on-error")) {
+            m_converterTask.params[CommandLineParser::ParamKey::BatchContinueOnError] = true;
+        }
+
+        if (m_parser.isSet("job-report")) {
+            m_converterTask.params[CommandLineParser::ParamKey::BatchReportPath] = fromUserInputPath(m_parser.value("job-report"));
+        }
+
+        //! NOTE Options that affect the result of a conversion are passed on to the worker processes
+        QStringList workerArgs;
+        for (const QString& name : QStringList { "r", "T", "b", "M" }) {
+            if (m_parser.isSet(name)) {
+                workerArgs << ("-" + name) << m_parser.value(name);
+            }
+        }
+
+        for (const QString& name : QStringList { "t", "template-mode", "gp-linked", "gp-experimental" }) {
+            if (m_parser.isSet(name)) {
+                workerArgs << (name.size() == 1 ? "-" + name : "--" + name);
+            }
+        }
+
+        m_converterTask.params[CommandLineParser::ParamKey::BatchWorkerArguments] = workerArgs;
+    }
+
+    if (m_parser.isSet("converter-daemon")) {
+        m_runMode = IApplication::RunMode::ConsoleApp;
+        m_converterTask.type = ConvertType::Daemon;
     }
 
     if (m_parser.isSet("score-media")) {
@@ -95,6 +95,7 @@ public:
     enum class ConvertType {
         File,
         Batch,
+        Daemon,
         ConvertScoreParts,
         ExportScoreMedia,
         ExportScoreMeta,
@@ -112,6 +113,12 @@ public:
         ScoreTransposeOptions,
         ForceMode,
 
+        // Batch
+        BatchJobs,
+        BatchContinueOnError,
+        BatchReportPath,
+        BatchWorkerArguments,
+
         // Video
     };
 
@@ -32,6 +32,8 @@ enum class Err {
 
     BatchJobFileFailedOpen = 1301,
     BatchJobFileFailedParse = 1302,
+    BatchJobReportFailedWrite = 1304,
+    DaemonJobFailedParse = 1305,
 
     ConvertTypeUnknown = 1310,
 
@@ -0,0 +1,48 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2023 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#ifndef MU_CONVERTER_CONVERTERTYPES_H
+#define MU_CONVERTER_CONVERTERTYPES_H
+
+#include <string>
+#include <vector>
+
+#include "io/path.h"
+
+namespace mu::converter {
+struct BatchConvertOptions {
+    //! NOTE Number of jobs converted at the same time.
+    //! When greater than 1, every job is converted in a separate worker process,
+    //! so that each conversion works with its own, isolated score/project instance
+    int jobs = 1;
+
+    bool continueOnError = false;
+
+    //! NOTE If set, a per-job result report (JSON) is written to this file
+    io::path_t reportPath;
+
+    //! NOTE Additional command line arguments passed to the worker processes
+    //! (image resolution, trim, bitrate, etc.)
+    std::vector<std::string> workerArguments;
+};
+}
+
+#endif // MU_CONVERTER_CONVERTERTYPES_H
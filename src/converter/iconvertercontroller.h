@@ -26,6 +26,8 @@
 #include "types/ret.h"
 #include "io/path.h"
 
+#include "convertertypes.h"
+
 namespace mu::converter {
 class IConverterController : MODULE_EXPORT_INTERFACE
 {
@@ -35,7 +37,12 @@ public:
 
     virtual Ret fileConvert(const io::path_t& in, const io::path_t& out, const io::path_t& stylePath = io::path_t(),
                             bool forceMode = false) = 0;
-    virtual Ret batchConvert(const io::path_t& batchJobFile, const io::path_t& stylePath = io::path_t(), bool forceMode = false) = 0;
+    virtual Ret batchConvert(const io::path_t& batchJobFile, const io::path_t& stylePath = io::path_t(), bool forceMode = false,
+                             const BatchConvertOptions& options = BatchConvertOptions()) = 0;
+    //! NOTE Keeps the process running and converts jobs read from stdin (one JSON object per line),
+    //! reusing the already loaded fonts, styles and instruments between the jobs
+    virtual Ret runDaemon(const io::path_t& stylePath = io::path_t(), bool forceMode = false) = 0;
+
     virtual Ret convertScoreParts(const io::path_t& in, const io::path_t& out,
                                   const io::path_t& stylePath = io::path_t(), bool forceMode = false) = 0;
 
@@ -21,13 +21,17 @@
  */
 #include "convertercontroller.h"
 
+#include <iostream>
+
 #include <QFile>
+#include <QElapsedTimer>
 #include <QJsonDocument>
 #include <QJsonObject>
 #include <QJsonArray>
 #include <QJsonParseError>
 
 #include "io/dir.h"
+#include "concurrency/taskscheduler.h"
 #include "stringutils.h"
 
 #include "convertercodes.h"
@@ -43,7 +47,8 @@ static const std::string PDF_SUFFIX = "pdf";
 static const std::string PNG_SUFFIX = "png";
 static const std::string SVG_SUFFIX = "svg";
 
-mu::Ret ConverterController::batchConvert(const io::path_t& batchJobFile, const io::path_t& stylePath, bool forceMode)
+mu::Ret ConverterController::batchConvert(const io::path_t& batchJobFile, const io::path_t& stylePath, bool forceMode,
+                                          const BatchConvertOptions& options)
 {
     TRACEFUNC;
 
@@ -53,16 +58,296 @@ mu::Ret ConverterController::batchConvert(const io::path_t& batchJobFile, const
         return batchJob.ret;
     }
 
-    Ret ret = make_ret(Ret::Code::Ok);
-    for (const Job& job : batchJob.val) {
-        ret = fileConvert(job.in, job.out, stylePath, forceMode);
+    JobResultList results;
+    if (options.jobs > 1 && batchJob.val.size() > 1) {
+        results = convertJobsInParallel(batchJob.val, stylePath, forceMode, options);
+    } else {
+        results = convertJobsSequentially(batchJob.val, stylePath, forceMode, options);
+    }
+
+    if (!options.reportPath.empty()) {
+        Ret ret = writeBatchJobReport(results, options.reportPath);
+        if (!ret) {
+            LOGE() << "failed write batch job report, err: " << ret.toString() << ", path: " << options.reportPath;
+            return ret;
+        }
+    }
+
+    //! NOTE Return the code of the first failed job, like converting the jobs one by one does,
+    //! the jobs skipped because of it are not taken into account
+    const JobResult* firstFailed = nullptr;
+    size_t failedCount = 0;
+    for (const JobResult& result : results) {
+        if (result.code == int(Ret::Code::Ok) || result.code == int(Ret::Code::Cancel)) {
+            continue;
+        }
+        if (!firstFailed) {
+            firstFailed = &result;
+        }
+        ++failedCount;
+    }
+
+    if (!firstFailed) {
+        return make_ret(Ret::Code::Ok);
+    }
+
+    if (failedCount > 1) {
+        LOGE() << failedCount << " of " << batchJob.val.size() << " jobs failed";
+    }
+
+    return Ret(firstFailed->code, firstFailed->text);
+}
+
+ConverterController::JobResultList ConverterController::convertJobsSequentially(const BatchJob& batchJob, const io::path_t& stylePath,
+                                                                                 bool forceMode, const BatchConvertOptions& options)
+{
+    TRACEFUNC;
+
+    JobResultList results;
+    results.reserve(batchJob.size());
+
+    for (const Job& job : batchJob) {
+        QElapsedTimer timer;
+        timer.start();
+
+        Ret ret = fileConvert(job.in, job.out, stylePath, forceMode);
+
+        JobResult result;
+        result.job = job;
+        result.code = ret.code();
+        result.text = ret.text();
+        result.durationMs = timer.elapsed();
+        results.push_back(std::move(result));
+
         if (!ret) {
             LOGE() << "failed convert, err: " << ret.toString() << ", in: " << job.in << ", out: " << job.out;
+            if (!options.continueOnError) {
+                break;
+            }
+        }
+    }
+
+    return results;
+}
+
+ConverterController::JobResultList ConverterController::convertJobsInParallel(const BatchJob& batchJob, const io::path_t& stylePath,
+                                                                               bool forceMode, const BatchConvertOptions& options)
+{
+    TRACEFUNC;
+
+    //! NOTE The engraving model is not thread safe (global styles, fonts, palette score, etc.),
+    //! so the jobs are not converted in threads of this process, but each job is converted
+    //! in its own worker process. The threads here only start the workers and wait for them.
+    TaskScheduler scheduler(static_cast<thread_pool_size_t>(std::min<size_t>(options.jobs, batchJob.size())));
+
+    std::atomic<bool> aborted = false;
+    std::vector<std::future<JobResult> > futures;
+    futures.reserve(batchJob.size());
+
+    for (const Job& job : batchJob) {
+        futures.push_back(scheduler.submit([this, &aborted, job, stylePath, forceMode, options]() {
+            if (aborted) {
+                JobResult skipped;
+                skipped.job = job;
+                skipped.code = int(Ret::Code::Cancel);
+                skipped.text = "skipped because of a previous error";
+                return skipped;
+            }
+
+            JobResult result = convertJobInWorkerProcess(job, stylePath, forceMode, options);
+            if (result.code != int(Ret::Code::Ok)) {
+                LOGE() << "failed convert, err: " << result.code << ", in: " << job.in << ", out: " << job.out;
+                if (!options.continueOnError) {
+                    aborted = true;
+                }
+            }
+
+            return result;
+        }));
+    }
+
+    JobResultList results;
+    results.reserve(futures.size());
+
+    for (std::future<JobResult>& future : futures) {
+        results.push_back(future.get());
+    }
+
+    return results;
+}
+
+ConverterController::JobResult ConverterController::convertJobInWorkerProcess(const Job& job, const io::path_t& stylePath,
+                                                                              bool forceMode, const BatchConvertOptions& options)
+{
+    std::vector<std::string> args = { job.in.toStdString(), "-o", job.out.toStdString() };
+
+    if (!stylePath.empty()) {
+        args.push_back("-S");
+        args.push_back(stylePath.toStdString());
+    }
+
+    if (forceMode) {
+        args.push_back("-f");
+    }
+
+    args.insert(args.end(), options.workerArguments.cbegin(), options.workerArguments.cend());
+
+    QElapsedTimer timer;
+    timer.start();
+
+    JobResult result;
+    result.job = job;
+    int exitCode = process()->execute(globalConfiguration()->appBinPath().toStdString(), args);
+    result.durationMs = timer.elapsed();
+
+    //! NOTE See QProcess::execute, -2 and -1 are not exit statuses of the worker.
+    //! Otherwise the exit status is passed through: the worker exits with the code of its conversion,
+    //! so it is the same as the exit status of converting the job in this process
+    //! (on Linux and macOS the OS truncates it to 8 bits in both cases)
+    if (exitCode == -2) {
+        result.code = int(Ret::Code::UnknownError);
+        result.text = "failed to start worker process";
+    } else if (exitCode == -1) {
+        result.code = int(Ret::Code::UnknownError);
+        result.text = "worker process crashed";
+    } else {
+        result.code = exitCode;
+        if (exitCode != int(Ret::Code::Ok)) {
+            result.text = "worker process failed, exit status: " + std::to_string(exitCode);
+        }
+    }
+
+    return result;
+}
+
+mu::Ret ConverterController::writeBatchJobReport(const JobResultList& results, const io::path_t& reportPath) const
+{
+    TRACEFUNC;
+
+    QJsonArray jobs;
+    for (const JobResult& result : results) {
+        QJsonObject obj;
+        obj["in"] = result.job.in.toQString();
+        obj["out"] = result.job.out.toQString();
+        obj["success"] = result.code == int(Ret::Code::Ok);
+        obj["code"] = result.code;
+        if (!result.text.empty()) {
+            obj["error"] = QString::fromStdString(result.text);
+        }
+        obj["durationMs"] = static_cast<qint64>(result.durationMs);
+
+        jobs.append(obj);
+    }
+
+    QFile file(reportPath.toQString());
+    if (!file.open(QFile::WriteOnly)) {
+        return make_ret(Err::BatchJobReportFailedWrite);
+    }
+
+    file.write(QJsonDocument(jobs).toJson());
+    file.close();
+
+    return make_ret(Ret::Code::Ok);
+}
+
+mu::Ret ConverterController::runDaemon(const io::path_t& stylePath, bool forceMode)
+{
+    TRACEFUNC;
+
+    QFile output;
+    if (!output.open(stdout, QFile::WriteOnly)) {
+        return make_ret(Ret::Code::InternalError);
+    }
+
+    LOGI() << "converter daemon started, waiting for jobs";
+
+    //! NOTE The first job pays for loading fonts, styles, instruments and so on,
+    //! all the following ones reuse the loaded state
+    bool warm = false;
+
+    std::string line;
+    while (std::getline(std::cin, line)) {
+        if (QString::fromStdString(line).trimmed().isEmpty()) {
+            continue;
+        }
+
+        io::path_t jobStylePath = stylePath;
+        bool jobForceMode = forceMode;
+        RetVal<Job> job = parseDaemonJob(line, jobStylePath, jobForceMode);
+
+        QJsonObject response;
+        if (!job.ret) {
+            response["success"] = false;
+            response["code"] = job.ret.code();
+            response["error"] = QString::fromStdString(job.ret.text());
+        } else if (job.val.in.empty()) {
+            //! NOTE An empty job is the quit command
             break;
+        } else {
+            QElapsedTimer timer;
+            timer.start();
+
+            Ret ret = fileConvert(job.val.in, job.val.out, jobStylePath, jobForceMode);
+
+            response["in"] = job.val.in.toQString();
+            response["out"] = job.val.out.toQString();
+            response["success"] = ret.success();
+            response["code"] = ret.code();
+            if (!ret.text().empty()) {
+                response["error"] = QString::fromStdString(ret.text());
+            }
+            response["durationMs"] = timer.elapsed();
+            response["warm"] = warm;
+
+            warm = true;
         }
+
+        output.write(QJsonDocument(response).toJson(QJsonDocument::Compact));
+        output.write("\n");
+        output.flush();
     }
 
-    return ret;
+    LOGI() << "converter daemon finished";
+
+    return make_ret(Ret::Code::Ok);
+}
+
+mu::RetVal<ConverterController::Job> ConverterController::parseDaemonJob(const std::string& line, io::path_t& stylePath,
+                                                                         bool& forceMode) const
+{
+    RetVal<Job> rv;
+
+    QJsonParseError err;
+    QJsonDocument doc = QJsonDocument::fromJson(QByteArray::fromStdString(line), &err);
+    if (err.error != QJsonParseError::NoError || !doc.isObject()) {
+        rv.ret = make_ret(Err::DaemonJobFailedParse, err.errorString().toStdString());
+        return rv;
+    }
+
+    QJsonObject obj = doc.object();
+    rv.ret = make_ret(Ret::Code::Ok);
+
+    if (obj["command"].toString() == "quit") {
+        return rv;
+    }
+
+    rv.val.in = io::Dir::fromNativeSeparators(obj["in"].toString());
+    rv.val.out = io::Dir::fromNativeSeparators(obj["out"].toString());
+
+    if (rv.val.in.empty() || rv.val.out.empty()) {
+        rv.ret = make_ret(Err::DaemonJobFailedParse, "\"in\" and \"out\" are required");
+        return rv;
+    }
+
+    if (obj.contains("style")) {
+        stylePath = io::Dir::fromNativeSeparators(obj["style"].toString());
+    }
+
+    if (obj.contains("force")) {
+        forceMode = obj["force"].toBool();
+    }
+
+    return rv;
 }
 
 mu::Ret ConverterController::fileConvert(const io::path_t& in, const io::path_t& out, const io::path_t& stylePath, bool forceMode)
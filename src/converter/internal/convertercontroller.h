@@ -27,6 +27,8 @@
 #include "../iconvertercontroller.h"
 
 #include "modularity/ioc.h"
+#include "iprocess.h"
+#include "iglobalconfiguration.h"
 #include "project/iprojectcreator.h"
 #include "project/inotationwritersregister.h"
 #include "project/iprojectrwregister.h"
@@ -41,13 +43,18 @@ class ConverterController : public IConverterController
     INJECT(project::INotationWritersRegister, writers)
     INJECT(project::IProjectRWRegister, projectRW)
     INJECT(context::IGlobalContext, globalContext)
+    INJECT(IProcess, process)
+    INJECT(framework::IGlobalConfiguration, globalConfiguration)
 
 public:
     ConverterController() = default;
 
     Ret fileConvert(const io::path_t& in, const io::path_t& out, const io::path_t& stylePath = io::path_t(),
                     bool forceMode = false) override;
-    Ret batchConvert(const io::path_t& batchJobFile, const io::path_t& stylePath = io::path_t(), bool forceMode = false) override;
+    Ret batchConvert(const io::path_t& batchJobFile, const io::path_t& stylePath = io::path_t(), bool forceMode = false,
+                     const BatchConvertOptions& options = BatchConvertOptions()) override;
+    Ret runDaemon(const io::path_t& stylePath = io::path_t(), bool forceMode = false) override;
+
     Ret convertScoreParts(const io::path_t& in, const io::path_t& out, const io::path_t& stylePath = io::path_t(),
                           bool forceMode = false) override;
 
@@ -76,8 +83,28 @@ private:
 
     using BatchJob = std::list<Job>;
 
+    struct JobResult {
+        Job job;
+        int code = 0;
+        std::string text;
+        int64_t durationMs = 0;
+    };
+
+    using JobResultList = std::vector<JobResult>;
+
     RetVal<BatchJob> parseBatchJob(const io::path_t& batchJobFile) const;
 
+    JobResultList convertJobsSequentially(const BatchJob& batchJob, const io::path_t& stylePath, bool forceMode,
+                                          const BatchConvertOptions& options);
+    JobResultList convertJobsInParallel(const BatchJob& batchJob, const io::path_t& stylePath, bool forceMode,
+                                        const BatchConvertOptions& options);
+    JobResult convertJobInWorkerProcess(const Job& job, const io::path_t& stylePath, bool forceMode,
+                                        const BatchConvertOptions& options);
+
+    RetVal<Job> parseDaemonJob(const std::string& line, io::path_t& stylePath, bool& forceMode) const;
+
+    Ret writeBatchJobReport(const JobResultList& results, const io::path_t& reportPath) const;
+
     bool isConvertPageByPage(const std::string& suffix) const;
     Ret convertPageByPage(project::INotationWriterPtr writer, notation::INotationPtr notation, const io::path_t& out) const;
     Ret convertFullNotation(project::INotationWriterPtr writer, notation::INotationPtr notation, const io::path_t& out) const;
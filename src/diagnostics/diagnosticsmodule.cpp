@@ -32,6 +32,7 @@
 #include "internal/diagnosticsactions.h"
 #include "internal/diagnosticsactionscontroller.h"
 #include "internal/diagnosticspathsregister.h"
+#include "internal/diagnosticscountersregister.h"
 #include "internal/engravingelementsprovider.h"
 #include "internal/savediagnosticfilesscenario.h"
 
@@ -71,6 +72,7 @@ void DiagnosticsModule::registerExports()
     m_actionsController = std::make_shared<DiagnosticsActionsController>();
 
     ioc()->registerExport<IDiagnosticsPathsRegister>(moduleName(), new DiagnosticsPathsRegister());
+    ioc()->registerExport<IDiagnosticsCountersRegister>(moduleName(), new DiagnosticsCountersRegister());
     ioc()->registerExport<IEngravingElementsProvider>(moduleName(), new EngravingElementsProvider());
     ioc()->registerExport<IDiagnosticDrawProvider>(moduleName(), new DiagnosticDrawProvider());
     ioc()->registerExport<IDiagnosticsConfiguration>(moduleName(), m_configuration);
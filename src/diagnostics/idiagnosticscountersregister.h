@@ -0,0 +1,53 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2023 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#ifndef MU_DIAGNOSTICS_IDIAGNOSTICSCOUNTERSREGISTER_H
+#define MU_DIAGNOSTICS_IDIAGNOSTICSCOUNTERSREGISTER_H
+
+#include <functional>
+#include <string>
+#include <vector>
+
+#include "modularity/imoduleinterface.h"
+
+namespace mu::diagnostics {
+class IDiagnosticsCountersRegister : MODULE_EXPORT_INTERFACE
+{
+    INTERFACE_ID(IDiagnosticsCountersRegister)
+public:
+    virtual ~IDiagnosticsCountersRegister() = default;
+
+    //! NOTE The value is requested each time the counters are shown,
+    //! ex. "hits: 120, misses: 10, hit rate: 92.3%"
+    using ValueGetter = std::function<std::string()>;
+
+    struct Item
+    {
+        std::string name;
+        ValueGetter value;
+    };
+
+    virtual void reg(const std::string& name, const ValueGetter& value) = 0;
+    virtual const std::vector<Item>& items() const = 0;
+};
+}
+
+#endif // MU_DIAGNOSTICS_IDIAGNOSTICSCOUNTERSREGISTER_H
@@ -90,6 +90,17 @@ void ProfilerViewModel::reload()
         m_allList.append(item);
     }
 
+    group = "Counters";
+    if (countersRegister()) {
+        for (const IDiagnosticsCountersRegister::Item& counter : countersRegister()->items()) {
+            Item item;
+            item.group = group;
+            item.data = QString::fromStdString(counter.name + ": " + (counter.value ? counter.value() : std::string()));
+
+            m_allList.append(item);
+        }
+    }
+
     find(m_searchText);
 }
 
@@ -24,10 +24,16 @@
 
 #include <QAbstractListModel>
 
+#include "modularity/ioc.h"
+#include "idiagnosticscountersregister.h"
+
 namespace mu::diagnostics {
 class ProfilerViewModel : public QAbstractListModel
 {
     Q_OBJECT
+
+    INJECT(IDiagnosticsCountersRegister, countersRegister)
+
 public:
     explicit ProfilerViewModel(QObject* parent = 0);
 
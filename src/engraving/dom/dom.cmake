@@ -47,8 +47,6 @@ set(DOM_SRC
     ${CMAKE_CURRENT_LIST_DIR}/bracketItem.h
     ${CMAKE_CURRENT_LIST_DIR}/breath.cpp
     ${CMAKE_CURRENT_LIST_DIR}/breath.h
-    ${CMAKE_CURRENT_LIST_DIR}/bsp.cpp
-    ${CMAKE_CURRENT_LIST_DIR}/bsp.h
     ${CMAKE_CURRENT_LIST_DIR}/bsymbol.cpp
     ${CMAKE_CURRENT_LIST_DIR}/bsymbol.h
     ${CMAKE_CURRENT_LIST_DIR}/changeMap.cpp
@@ -277,6 +275,8 @@ set(DOM_SRC
     ${CMAKE_CURRENT_LIST_DIR}/spanner.h
     ${CMAKE_CURRENT_LIST_DIR}/spannermap.cpp
     ${CMAKE_CURRENT_LIST_DIR}/spannermap.h
+    ${CMAKE_CURRENT_LIST_DIR}/spatialindex.cpp
+    ${CMAKE_CURRENT_LIST_DIR}/spatialindex.h
     ${CMAKE_CURRENT_LIST_DIR}/splitMeasure.cpp
     ${CMAKE_CURRENT_LIST_DIR}/staff.cpp
     ${CMAKE_CURRENT_LIST_DIR}/staff.h
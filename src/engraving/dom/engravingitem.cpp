@@ -101,7 +101,6 @@ EngravingItem::EngravingItem(const EngravingItem& e)
     m_z          = e.m_z;
     m_color      = e.m_color;
     m_minDistance = e.m_minDistance;
-    itemDiscovered = false;
 
     m_accessibleEnabled = e.m_accessibleEnabled;
 }
@@ -2413,7 +2412,7 @@ const RectF& EngravingItem::LayoutData::bbox(LD_ACCESS mode) const
     return sh.bbox();
 }
 
-Shape EngravingItem::LayoutData::shape(LD_ACCESS mode) const
+const Shape& EngravingItem::LayoutData::shape(LD_ACCESS mode) const
 {
     const Shape& sh = m_shape.value(LD_ACCESS::CHECK);
 
@@ -2485,9 +2484,6 @@ Shape EngravingItem::LayoutData::shape(LD_ACCESS mode) const
             TLayout::fillTupletShape(toTuplet(m_item), static_cast<Tuplet::LayoutData*>(const_cast<LayoutData*>(this)));
             return m_shape.value(LD_ACCESS::CHECK);
         } break;
-        case ElementType::ACCIDENTAL: {
-            return Shape(sh.bbox(), m_item);
-        } break;
         default:
             break;
         }
@@ -389,8 +389,6 @@ public:
  */
     virtual bool mousePress(EditData&) { return false; }
 
-    mutable bool itemDiscovered      { false };       ///< helper flag for bsp
-
     void scanElements(void* data, void (* func)(void*, EngravingItem*), bool all=true) override;
 
     virtual void reset() override;           // reset all properties & position to default
@@ -535,7 +533,7 @@ public:
 
         bool isSetShape() const { return m_shape.has_value(); }
         void clearShape() { m_shape.reset(); }
-        Shape shape(LD_ACCESS mode = LD_ACCESS::CHECK) const;
+        const Shape& shape(LD_ACCESS mode = LD_ACCESS::CHECK) const;
 
         void setShape(const Shape& sh) { m_shape.set_value(sh); }
 
@@ -592,7 +590,7 @@ public:
     LayoutData* mutldata();
 
     virtual double mag() const;
-    Shape shape(LD_ACCESS mode = LD_ACCESS::CHECK) const { return ldata()->shape(mode); }
+    const Shape& shape(LD_ACCESS mode = LD_ACCESS::CHECK) const { return ldata()->shape(mode); }
     virtual double baseLine() const { return -height(); }
 
     mu::RectF abbox(LD_ACCESS mode = LD_ACCESS::CHECK) const { return ldata()->bbox(mode).translated(pagePos()); }
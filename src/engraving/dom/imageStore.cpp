@@ -148,13 +148,32 @@ ImageStore::~ImageStore()
 }
 
 //---------------------------------------------------------
-//   getImage
+//   hashFromName
+//    the hash is the base name of the stored image:
+//    32 hex digits of the 16 byte md4 hash
 //---------------------------------------------------------
 
-ImageStoreItem* ImageStore::getImage(const path_t& path) const
+static bool hashFromName(const path_t& path, ByteArray& hash)
 {
     String s = FileInfo(path).completeBaseName();
     if (s.size() != 32) {
+        return false;
+    }
+    hash = ByteArray(16);
+    for (int i = 0; i < 16; ++i) {
+        hash[i] = toInt(s.at(i * 2).toAscii()) * 16 + toInt(s.at(i * 2 + 1).toAscii());
+    }
+    return true;
+}
+
+//---------------------------------------------------------
+//   getImage
+//---------------------------------------------------------
+
+ImageStoreItem* ImageStore::getImage(const path_t& path) const
+{
+    ByteArray hash;
+    if (!hashFromName(path, hash)) {
         //
         // some limited support for backward compatibility
         //
@@ -165,10 +184,6 @@ ImageStoreItem* ImageStore::getImage(const path_t& path) const
         }
         return nullptr;
     }
-    ByteArray hash(16);
-    for (int i = 0; i < 16; ++i) {
-        hash[i] = toInt(s.at(i * 2).toAscii()) * 16 + toInt(s.at(i * 2 + 1).toAscii());
-    }
     for (ImageStoreItem* item : _items) {
         if (item->hash() == hash) {
             return item;
@@ -196,6 +211,43 @@ ImageStoreItem* ImageStore::add(const path_t& path, const ByteArray& ba)
     return item;
 }
 
+//---------------------------------------------------------
+//   addLazy
+//    add an item without data, for an image stored under its hash name;
+//    the data is expected to be set later, when the image turns out to be used.
+//    Returns nullptr if the name is not a hash name
+//---------------------------------------------------------
+
+ImageStoreItem* ImageStore::addLazy(const path_t& path)
+{
+    ByteArray hash;
+    if (!hashFromName(path, hash)) {
+        return nullptr;
+    }
+    for (ImageStoreItem* item : _items) {
+        if (item->hash() == hash) {
+            return item;
+        }
+    }
+    ImageStoreItem* item = new ImageStoreItem(path);
+    item->set(ByteArray(), hash);
+    _items.push_back(item);
+    return item;
+}
+
+//---------------------------------------------------------
+//   remove
+//---------------------------------------------------------
+
+void ImageStore::remove(ImageStoreItem* item)
+{
+    auto it = std::find(_items.begin(), _items.end(), item);
+    if (it != _items.end()) {
+        _items.erase(it);
+        delete item;
+    }
+}
+
 //---------------------------------------------------------
 //   clearUnused
 //---------------------------------------------------------
@@ -87,6 +87,8 @@ public:
 
     ImageStoreItem* getImage(const io::path_t& path) const;
     ImageStoreItem* add(const io::path_t& path, const mu::ByteArray&);
+    ImageStoreItem* addLazy(const io::path_t& path);
+    void remove(ImageStoreItem* item);
     void clearUnused();
 
     typedef ItemList::iterator iterator;
@@ -61,6 +61,9 @@ MasterScore::MasterScore(std::weak_ptr<engraving::EngravingProject> project)
 {
     m_project = project;
     _undoStack   = new UndoStack();
+    if (configuration()) {
+        _undoStack->setLimits(configuration()->undoHistoryMaxSteps(), configuration()->undoHistoryMaxMemory());
+    }
     _tempomap    = new TempoMap;
     _sigmap      = new TimeSigMap();
     _expandedRepeatList  = new RepeatList(this);
@@ -625,14 +625,9 @@ ChordRest* Measure::findChordRest(Fraction t, track_idx_t track)
 Segment* Measure::tick2segment(const Fraction& _t, SegmentType st)
 {
     Fraction t = _t - tick();
-    for (Segment& s : m_segments) {
-        if (s.rtick() == t) {
-            if (s.segmentType() & st) {
-                return &s;
-            }
-        }
-        if (s.rtick() > t) {
-            break;
+    for (Segment* s = m_segments.lowerBound(t); s && s->rtick() == t; s = s->next()) {
+        if (s->segmentType() & st) {
+            return s;
         }
     }
     return 0;
@@ -646,20 +641,7 @@ Segment* Measure::tick2segment(const Fraction& _t, SegmentType st)
 
 Segment* Measure::findSegmentR(SegmentType st, const Fraction& t) const
 {
-    Segment* s;
-    if (t > (ticks() * Fraction(1, 2))) {
-        // search backwards
-        for (s = last(); s && s->rtick() > t; s = s->prev()) {
-        }
-        while (s && s->prev() && s->prev()->rtick() == t) {
-            s = s->prev();
-        }
-    } else {
-        // search forwards
-        for (s = first(); s && s->rtick() < t; s = s->next()) {
-        }
-    }
-    for (; s && s->rtick() == t; s = s->next()) {
+    for (Segment* s = m_segments.lowerBound(t); s && s->rtick() == t; s = s->next()) {
         if (s->segmentType() & st) {
             return s;
         }
@@ -676,6 +676,11 @@ MeasureBaseList::MeasureBaseList()
 
 void MeasureBaseList::push_back(MeasureBase* e)
 {
+    //! NOTE appending keeps the index valid
+    if (m_measureIndexValid && e->isMeasure()) {
+        m_measureIndex.push_back(toMeasure(e));
+    }
+
     ++m_size;
     if (m_last) {
         m_last->setNext(e);
@@ -695,6 +700,7 @@ void MeasureBaseList::push_back(MeasureBase* e)
 
 void MeasureBaseList::push_front(MeasureBase* e)
 {
+    m_measureIndexValid = false;
     ++m_size;
     if (m_first) {
         m_first->setPrev(e);
@@ -724,6 +730,7 @@ void MeasureBaseList::add(MeasureBase* e)
         push_front(e);
         return;
     }
+    m_measureIndexValid = false;
     ++m_size;
     e->setPrev(el->prev());
     el->prev()->setNext(e);
@@ -736,6 +743,7 @@ void MeasureBaseList::add(MeasureBase* e)
 
 void MeasureBaseList::remove(MeasureBase* el)
 {
+    m_measureIndexValid = false;
     --m_size;
     if (el->prev()) {
         el->prev()->setNext(el->next());
@@ -755,6 +763,7 @@ void MeasureBaseList::remove(MeasureBase* el)
 
 void MeasureBaseList::insert(MeasureBase* fm, MeasureBase* lm)
 {
+    m_measureIndexValid = false;
     ++m_size;
     for (MeasureBase* m = fm; m != lm; m = m->next()) {
         ++m_size;
@@ -779,6 +788,7 @@ void MeasureBaseList::insert(MeasureBase* fm, MeasureBase* lm)
 
 void MeasureBaseList::remove(MeasureBase* fm, MeasureBase* lm)
 {
+    m_measureIndexValid = false;
     --m_size;
     for (MeasureBase* m = fm; m != lm; m = m->next()) {
         --m_size;
@@ -803,6 +813,7 @@ void MeasureBaseList::remove(MeasureBase* fm, MeasureBase* lm)
 
 void MeasureBaseList::change(MeasureBase* ob, MeasureBase* nb)
 {
+    m_measureIndexValid = false;
     nb->setPrev(ob->prev());
     nb->setNext(ob->next());
     if (ob->prev()) {
@@ -825,3 +836,25 @@ void MeasureBaseList::change(MeasureBase* ob, MeasureBase* nb)
         e->setParent(nb);
     }
 }
+
+//---------------------------------------------------------
+//   measureIndex
+//---------------------------------------------------------
+
+const std::vector<Measure*>& MeasureBaseList::measureIndex() const
+{
+    if (m_measureIndexValid) {
+        return m_measureIndex;
+    }
+
+    m_measureIndex.clear();
+    m_measureIndex.reserve(m_size);
+    for (MeasureBase* mb = m_first; mb; mb = mb->next()) {
+        if (mb->isMeasure()) {
+            m_measureIndex.push_back(toMeasure(mb));
+        }
+    }
+    m_measureIndexValid = true;
+
+    return m_measureIndex;
+}
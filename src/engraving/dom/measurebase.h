@@ -210,7 +210,7 @@ public:
     MeasureBaseList();
     MeasureBase* first() const { return m_first; }
     MeasureBase* last()  const { return m_last; }
-    void clear() { m_first = m_last = 0; m_size = 0; }
+    void clear() { m_first = m_last = 0; m_size = 0; m_measureIndexValid = false; }
     void add(MeasureBase*);
     void remove(MeasureBase*);
     void insert(MeasureBase*, MeasureBase*);
@@ -219,6 +219,10 @@ public:
     int size() const { return m_size; }
     bool empty() const { return m_size == 0; }
 
+    //! NOTE Measures (without boxes) in list order, rebuilt on demand after the list has changed.
+    //! Measure ticks are ascending, so it can be searched by tick (see Score::tick2measure)
+    const std::vector<Measure*>& measureIndex() const;
+
 private:
     void push_back(MeasureBase* e);
     void push_front(MeasureBase* e);
@@ -226,6 +230,9 @@ private:
     int m_size = 0;
     MeasureBase* m_first = nullptr;
     MeasureBase* m_last = nullptr;
+
+    mutable std::vector<Measure*> m_measureIndex;
+    mutable bool m_measureIndexValid = false;
 };
 } // namespace mu::engraving
 #endif
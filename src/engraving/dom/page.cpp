@@ -22,6 +22,8 @@
 
 #include "page.h"
 
+#include <algorithm>
+
 #ifndef ENGRAVING_NO_ACCESSIBILITY
 #include "accessibility/accessibleitem.h"
 #endif
@@ -34,6 +36,7 @@
 #include "system.h"
 #include "text.h"
 
+#include "containers.h"
 #include "log.h"
 
 using namespace mu;
@@ -51,27 +54,78 @@ static String revision;
 Page::Page(RootItem* parent)
     : EngravingItem(ElementType::PAGE, parent, ElementFlag::NOT_SELECTABLE), _no(0)
 {
-    bspTreeValid = false;
 }
 
 //---------------------------------------------------------
 //   items
 //---------------------------------------------------------
 
-std::vector<EngravingItem*> Page::items(const RectF& rect)
+std::vector<EngravingItem*> Page::items(const RectF& rect) const
+{
+    ensureSpatialIndex();
+
+    std::shared_lock lock(m_spatialIndex.mutex);
+    return m_spatialIndex.index.items(rect);
+}
+
+std::vector<EngravingItem*> Page::items(const mu::PointF& point) const
+{
+    ensureSpatialIndex();
+
+    std::shared_lock lock(m_spatialIndex.mutex);
+    return m_spatialIndex.index.items(point);
+}
+
+//---------------------------------------------------------
+//   invalidateSpatialIndex
+//---------------------------------------------------------
+
+void Page::invalidateSpatialIndex()
+{
+    std::unique_lock lock(m_spatialIndex.mutex);
+    m_spatialIndex.valid = false;
+    m_spatialIndex.invalidSystems.clear();
+}
+
+//---------------------------------------------------------
+//   invalidateSpatialIndex
+//    only the items of the given system are indexed again
+//---------------------------------------------------------
+
+void Page::invalidateSpatialIndex(const System* system)
 {
-    if (!bspTreeValid) {
-        doRebuildBspTree();
+    std::unique_lock lock(m_spatialIndex.mutex);
+    if (m_spatialIndex.valid && !mu::contains(m_spatialIndex.invalidSystems, system)) {
+        m_spatialIndex.invalidSystems.push_back(system);
     }
-    return bspTree.items(rect);
 }
 
-std::vector<EngravingItem*> Page::items(const mu::PointF& point)
+//---------------------------------------------------------
+//   ensureSpatialIndex
+//---------------------------------------------------------
+
+void Page::ensureSpatialIndex() const
 {
-    if (!bspTreeValid) {
-        doRebuildBspTree();
+    {
+        std::shared_lock lock(m_spatialIndex.mutex);
+        if (m_spatialIndex.valid && m_spatialIndex.invalidSystems.empty()) {
+            return;
+        }
+    }
+
+    std::unique_lock lock(m_spatialIndex.mutex);
+
+    if (!m_spatialIndex.valid) {
+        doRebuildSpatialIndex();
+        return;
+    }
+
+    for (const System* system : m_spatialIndex.invalidSystems) {
+        doUpdateSpatialIndex(system);
     }
-    return bspTree.items(point);
+
+    m_spatialIndex.invalidSystems.clear();
+    m_spatialIndex.index.packIfNeeded();
 }
 
 //---------------------------------------------------------
@@ -248,28 +302,26 @@ void Page::scanElements(void* data, void (* func)(void*, EngravingItem*), bool a
 }
 
 //---------------------------------------------------------
-//   bspInsert
+//   SpatialIndexInserter
 //---------------------------------------------------------
 
-static void bspInsert(void* bspTree, EngravingItem* e)
-{
-    ((BspTree*)bspTree)->insert(e);
-}
+struct SpatialIndexInserter {
+    SpatialIndex* index = nullptr;
+    SpatialIndex::Group group = nullptr;
 
-static void countElements(void* data, EngravingItem* /*e*/)
-{
-    ++(*(int*)data);
-}
+    static void insert(void* data, EngravingItem* e)
+    {
+        SpatialIndexInserter* inserter = static_cast<SpatialIndexInserter*>(data);
+        inserter->index->insert(e, inserter->group);
+    }
+};
 
 //---------------------------------------------------------
-//   doRebuildBspTree
+//   doRebuildSpatialIndex
 //---------------------------------------------------------
 
-void Page::doRebuildBspTree()
+void Page::doRebuildSpatialIndex() const
 {
-    int n = 0;
-    scanElements(&n, countElements, false);
-
     RectF r;
     if (score()->linearMode()) {
         double w = 0.0;
@@ -286,9 +338,50 @@ void Page::doRebuildBspTree()
         r = abbox();
     }
 
-    bspTree.initialize(r, n);
-    scanElements(&bspTree, &bspInsert, false);
-    bspTreeValid = true;
+    SpatialIndex& index = m_spatialIndex.index;
+    index.reset(r);
+
+    //! NOTE The same items as scanElements() gives, grouped by the systems
+    SpatialIndexInserter inserter { &index, nullptr };
+    for (System* s : _systems) {
+        inserter.group = s;
+        for (MeasureBase* m : s->measures()) {
+            m->scanElements(&inserter, &SpatialIndexInserter::insert, false);
+        }
+        s->scanElements(&inserter, &SpatialIndexInserter::insert, false);
+    }
+
+    inserter.group = nullptr;
+    SpatialIndexInserter::insert(&inserter, const_cast<Page*>(this));
+
+    index.pack();
+
+    m_spatialIndex.valid = true;
+    m_spatialIndex.invalidSystems.clear();
+}
+
+//---------------------------------------------------------
+//   doUpdateSpatialIndex
+//---------------------------------------------------------
+
+void Page::doUpdateSpatialIndex(const System* system) const
+{
+    SpatialIndex& index = m_spatialIndex.index;
+    index.removeGroup(system);
+
+    // the system may be moved to another page meanwhile
+    auto it = std::find(_systems.begin(), _systems.end(), system);
+    if (it == _systems.end()) {
+        return;
+    }
+
+    System* s = *it;
+
+    SpatialIndexInserter inserter { &index, s };
+    for (MeasureBase* m : s->measures()) {
+        m->scanElements(&inserter, &SpatialIndexInserter::insert, false);
+    }
+    s->scanElements(&inserter, &SpatialIndexInserter::insert, false);
 }
 
 //---------------------------------------------------------
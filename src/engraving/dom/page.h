@@ -24,9 +24,10 @@
 #define __PAGE_H__
 
 #include <vector>
+#include <shared_mutex>
 
 #include "engravingitem.h"
-#include "bsp.h"
+#include "spatialindex.h"
 
 namespace mu::engraving {
 class RootItem;
@@ -51,10 +52,24 @@ class Page final : public EngravingItem
     std::vector<System*> _systems;
     page_idx_t _no;                        // page number
 
-    BspTree bspTree;
-    bool bspTreeValid;
+    //! NOTE The index is rebuilt lazily by the first query after the invalidation,
+    //! the mutex allows to query the items from several threads
+    struct SpatialIndexData {
+        SpatialIndex index;
+        bool valid = false;
+        std::vector<const System*> invalidSystems;
+        std::shared_mutex mutex;
 
-    void doRebuildBspTree();
+        SpatialIndexData() = default;
+        SpatialIndexData(const SpatialIndexData&) {}
+        SpatialIndexData& operator=(const SpatialIndexData&) { valid = false; return *this; }
+    };
+
+    mutable SpatialIndexData m_spatialIndex;
+
+    void ensureSpatialIndex() const;
+    void doRebuildSpatialIndex() const;
+    void doUpdateSpatialIndex(const System* system) const;
 
     friend class Factory;
     Page(RootItem* parent);
@@ -86,9 +101,10 @@ public:
 
     void scanElements(void* data, void (* func)(void*, EngravingItem*), bool all=true) override;
 
-    std::vector<EngravingItem*> items(const mu::RectF& r);
-    std::vector<EngravingItem*> items(const mu::PointF& p);
-    void invalidateBspTree() { bspTreeValid = false; }
+    std::vector<EngravingItem*> items(const mu::RectF& r) const;
+    std::vector<EngravingItem*> items(const mu::PointF& p) const;
+    void invalidateSpatialIndex();
+    void invalidateSpatialIndex(const System* system);
     mu::PointF pagePos() const override { return mu::PointF(); }       ///< position in page coordinates
     std::vector<EngravingItem*> elements() const;              ///< list of visible elements
     mu::RectF tbbox() const;                             // tight bounding box, excluding white space
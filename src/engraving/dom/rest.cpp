@@ -36,10 +36,12 @@
 #include "measure.h"
 #include "measurerepeat.h"
 #include "note.h"
+#include "page.h"
 #include "score.h"
 #include "segment.h"
 #include "staff.h"
 #include "stafftype.h"
+#include "system.h"
 #include "undo.h"
 
 #include "log.h"
@@ -158,7 +160,13 @@ mu::RectF Rest::drag(EditData& ed)
 
     renderer()->layoutItem(this);
 
-    score()->rebuildBspTree();
+    // only the system of the rest is indexed again
+    if (System* s = measure() ? measure()->system() : nullptr) {
+        if (Page* p = s->page()) {
+            p->invalidateSpatialIndex(s);
+        }
+    }
+
     return abbox().united(r);
 }
 
@@ -682,10 +682,10 @@ void Score::dragPosition(const PointF& p, staff_idx_t* rst, Segment** seg, doubl
 void Score::setShowInvisible(bool v)
 {
     m_showInvisible = v;
-    // BSP tree does not include elements which are not
+    // The spatial index does not include elements which are not
     // displayed, so we need to refresh it to get
     // invisible elements displayed or properly hidden.
-    rebuildBspTree();
+    invalidateSpatialIndex();
 }
 
 //---------------------------------------------------------
@@ -5432,10 +5432,10 @@ ShadowNote* Score::shadowNote() const
     return m_shadowNote;
 }
 
-void Score::rebuildBspTree()
+void Score::invalidateSpatialIndex()
 {
     for (Page* page : pages()) {
-        page->invalidateBspTree();
+        page->invalidateSpatialIndex();
     }
 }
 
@@ -275,7 +275,7 @@ public:
 
     mu::async::Channel<EngravingItem*> elementDestroyed();
 
-    void rebuildBspTree();
+    void invalidateSpatialIndex();
     bool noStaves() const { return m_staves.empty(); }
     void insertPart(Part*, size_t targetPartIdx);
     void appendPart(Part*);
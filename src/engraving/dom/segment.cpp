@@ -2300,14 +2300,14 @@ void Segment::createShape(staff_idx_t staffIdx)
                 continue;
             }
             if (e->addToSkyline()) {
-                s.add(e->shape().translate(e->isClef() ? e->ldata()->pos() : e->pos()));
+                s.add(e->shape(), e->isClef() ? e->ldata()->pos() : e->pos());
             }
             // Non-standard trills display a cue note that we must add to shape here
             if (e->isChord()) {
                 Ornament* orn = toChord(e)->findOrnament();
                 Chord* cueNoteChord = orn ? orn->cueNoteChord() : nullptr;
                 if (cueNoteChord && cueNoteChord->upNote()->visible()) {
-                    s.add(cueNoteChord->shape().translate(cueNoteChord->pos()));
+                    s.add(cueNoteChord->shape(), cueNoteChord->pos());
                 }
             }
         }
@@ -2350,7 +2350,7 @@ void Segment::createShape(staff_idx_t staffIdx)
                    && !e->isStringTunings()) {
             // annotations added here are candidates for collision detection
             // lyrics, ...
-            s.add(e->shape().translate(e->pos()));
+            s.add(e->shape(), e->pos());
         }
     }
 }
@@ -2367,7 +2367,7 @@ void Segment::addPreAppendedToShape()
             toGraceNotesGroup(item)->addToShape();
         } else {
             Shape& shape = _shapes[item->vStaffIdx()];
-            shape.add(item->shape().translated(item->pos()));
+            shape.add(item->shape(), item->pos());
         }
     }
 }
@@ -2423,9 +2423,9 @@ double Segment::elementsTopOffsetFromSkyline(staff_idx_t staffIndex) const
         return 0;
     }
 
-    SkylineLine north = staffSystem->skyline().north();
+    const SkylineLine& north = staffSystem->skyline().north();
     int topOffset = INT_MAX;
-    for (SkylineSegment segment: north) {
+    for (const SkylineSegment& segment: north) {
         Segment* seg = prev1enabled();
         if (!seg) {
             continue;
@@ -2456,9 +2456,9 @@ double Segment::elementsBottomOffsetFromSkyline(staff_idx_t staffIndex) const
         return 0;
     }
 
-    SkylineLine south = staffSystem->skyline().south();
+    const SkylineLine& south = staffSystem->skyline().south();
     int bottomOffset = INT_MIN;
-    for (SkylineSegment segment: south) {
+    for (const SkylineSegment& segment: south) {
         Segment* seg = prev1enabled();
         if (!seg) {
             continue;
@@ -265,7 +265,6 @@ public:
     using EngravingItem::prevElement;
     EngravingItem* prevElement(staff_idx_t activeStaff);
 
-    std::vector<Shape> shapes() { return _shapes; }
     const std::vector<Shape>& shapes() const { return _shapes; }
     const Shape& staffShape(staff_idx_t staffIdx) const { return _shapes[staffIdx]; }
     Shape& staffShape(staff_idx_t staffIdx) { return _shapes[staffIdx]; }
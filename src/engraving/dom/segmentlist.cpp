@@ -21,6 +21,9 @@
  */
 
 #include "segmentlist.h"
+
+#include <algorithm>
+
 #include "segment.h"
 #include "score.h"
 
@@ -124,6 +127,7 @@ void SegmentList::insert(Segment* e, Segment* el)
     } else if (el == first()) {
         push_front(e);
     } else {
+        _indexValid = false;
         ++_size;
         e->setNext(el);
         e->setPrev(el->prev());
@@ -152,6 +156,7 @@ void SegmentList::remove(Segment* e)
         ASSERT_X(String(u"segment %1 not in list").arg(String::fromAscii(e->subTypeName())));
     }
 #endif
+    _indexValid = false;
     --_size;
     if (e == _first) {
         _first = _first->next();
@@ -178,6 +183,11 @@ void SegmentList::remove(Segment* e)
 
 void SegmentList::push_back(Segment* e)
 {
+    //! NOTE appending keeps the index valid
+    if (_indexValid) {
+        _index.push_back(e);
+    }
+
     ++_size;
     e->setNext(0);
     if (_last) {
@@ -196,6 +206,7 @@ void SegmentList::push_back(Segment* e)
 
 void SegmentList::push_front(Segment* e)
 {
+    _indexValid = false;
     ++_size;
     e->setPrev(0);
     if (_first) {
@@ -208,6 +219,40 @@ void SegmentList::push_front(Segment* e)
     check();
 }
 
+//---------------------------------------------------------
+//   lowerBound
+///   Return the first segment with rtick not less than
+///   \a rtick. Segments are ordered by rtick, so short lists
+///   are walked and longer ones are searched by the index.
+//---------------------------------------------------------
+
+Segment* SegmentList::lowerBound(const Fraction& rtick) const
+{
+    static constexpr int MIN_INDEXED_SIZE = 16;
+
+    if (_size < MIN_INDEXED_SIZE) {
+        Segment* s = _first;
+        while (s && s->rtick() < rtick) {
+            s = s->next();
+        }
+        return s;
+    }
+
+    if (!_indexValid) {
+        _index.clear();
+        _index.reserve(_size);
+        for (Segment* s = _first; s; s = s->next()) {
+            _index.push_back(s);
+        }
+        _indexValid = true;
+    }
+
+    auto it = std::lower_bound(_index.begin(), _index.end(), rtick, [](const Segment* s, const Fraction& t) {
+        return s->rtick() < t;
+    });
+    return it != _index.end() ? *it : nullptr;
+}
+
 //---------------------------------------------------------
 //   firstCRSegment
 //---------------------------------------------------------
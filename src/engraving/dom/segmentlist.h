@@ -23,6 +23,8 @@
 #ifndef __SEGMENTLIST_H__
 #define __SEGMENTLIST_H__
 
+#include <vector>
+
 #include "segment.h"
 
 namespace mu::engraving {
@@ -38,9 +40,12 @@ class SegmentList
     Segment* _last;           ///< Last item of segment list
     int _size;                ///< Number of items in segment list
 
+    mutable std::vector<Segment*> _index;   ///< Segments in list order, rebuilt on demand
+    mutable bool _indexValid = false;
+
 public:
     SegmentList() { clear(); }
-    void clear() { _first = _last = 0; _size = 0; }
+    void clear() { _first = _last = 0; _size = 0; _indexValid = false; }
 #ifndef NDEBUG
     void check();
 #else
@@ -61,6 +66,8 @@ public:
     void push_front(Segment*);
     void insert(Segment* e, Segment* el);    // insert e before el
 
+    Segment* lowerBound(const Fraction& rtick) const;   // first segment at or after rtick
+
     class iterator
     {
         Segment* p;
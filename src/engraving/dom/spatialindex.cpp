@@ -0,0 +1,313 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2023 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "spatialindex.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include "engravingitem.h"
+
+using namespace mu;
+using namespace mu::engraving;
+
+static constexpr size_t ITEMS_PER_CELL = 8;
+static constexpr size_t MAX_CELL_COUNT = 1 << 16;
+
+// the unpacked items are checked one by one, so they are packed when there are too many of them
+static constexpr size_t MAX_UNPACKED_COUNT = 64;
+
+//---------------------------------------------------------
+//   reset
+//---------------------------------------------------------
+
+void SpatialIndex::reset(const RectF& rect)
+{
+    clear();
+    m_rect = rect.normalized();
+}
+
+//---------------------------------------------------------
+//   clear
+//---------------------------------------------------------
+
+void SpatialIndex::clear()
+{
+    m_rect = RectF();
+    m_columns = 1;
+    m_rows = 1;
+    m_cellWidth = 0.0;
+    m_cellHeight = 0.0;
+
+    m_entries.clear();
+    m_cellStarts.clear();
+    m_cellEntries.clear();
+    m_unpackedEntries.clear();
+    m_removedCount = 0;
+}
+
+//---------------------------------------------------------
+//   insert
+//---------------------------------------------------------
+
+void SpatialIndex::insert(EngravingItem* item, Group group)
+{
+    Entry entry;
+    entry.rect = item->pageBoundingRect();
+    entry.item = item;
+    entry.group = group;
+    updateCellRange(entry);
+
+    m_unpackedEntries.push_back(static_cast<uint32_t>(m_entries.size()));
+    m_entries.push_back(entry);
+}
+
+//---------------------------------------------------------
+//   removeGroup
+//---------------------------------------------------------
+
+void SpatialIndex::removeGroup(Group group)
+{
+    for (Entry& entry : m_entries) {
+        if (entry.item && entry.group == group) {
+            entry.item = nullptr;
+            ++m_removedCount;
+        }
+    }
+}
+
+//---------------------------------------------------------
+//   pack
+//---------------------------------------------------------
+
+void SpatialIndex::pack()
+{
+    if (m_removedCount > 0) {
+        m_entries.erase(std::remove_if(m_entries.begin(), m_entries.end(), [](const Entry& entry) {
+            return entry.item == nullptr;
+        }), m_entries.end());
+        m_removedCount = 0;
+    }
+
+    m_unpackedEntries.clear();
+
+    // the grid cells are about square and hold ITEMS_PER_CELL items on average
+    size_t cellCount = std::clamp(m_entries.size() / ITEMS_PER_CELL, size_t(1), MAX_CELL_COUNT);
+    double width = m_rect.width();
+    double height = m_rect.height();
+
+    if (width > 0.0 && height > 0.0) {
+        m_columns = std::max(1, static_cast<int>(std::lround(std::sqrt(cellCount * width / height))));
+        m_columns = std::min(m_columns, static_cast<int>(cellCount));
+        m_rows = std::max(1, static_cast<int>(cellCount / m_columns));
+    } else {
+        m_columns = 1;
+        m_rows = 1;
+    }
+
+    m_cellWidth = width / m_columns;
+    m_cellHeight = height / m_rows;
+
+    for (Entry& entry : m_entries) {
+        updateCellRange(entry);
+    }
+
+    // counting sort of the entries into the cells
+    m_cellStarts.assign(static_cast<size_t>(m_columns) * m_rows + 1, 0);
+
+    for (const Entry& entry : m_entries) {
+        for (int r = entry.firstRow; r <= entry.lastRow; ++r) {
+            for (int c = entry.firstColumn; c <= entry.lastColumn; ++c) {
+                ++m_cellStarts[r * m_columns + c + 1];
+            }
+        }
+    }
+
+    for (size_t i = 1; i < m_cellStarts.size(); ++i) {
+        m_cellStarts[i] += m_cellStarts[i - 1];
+    }
+
+    m_cellEntries.resize(m_cellStarts.back());
+    std::vector<uint32_t> cellEnds(m_cellStarts.begin(), m_cellStarts.end() - 1);
+
+    for (size_t i = 0; i < m_entries.size(); ++i) {
+        const Entry& entry = m_entries[i];
+        for (int r = entry.firstRow; r <= entry.lastRow; ++r) {
+            for (int c = entry.firstColumn; c <= entry.lastColumn; ++c) {
+                m_cellEntries[cellEnds[r * m_columns + c]++] = static_cast<uint32_t>(i);
+            }
+        }
+    }
+}
+
+//---------------------------------------------------------
+//   packIfNeeded
+//---------------------------------------------------------
+
+void SpatialIndex::packIfNeeded()
+{
+    if (m_unpackedEntries.size() > MAX_UNPACKED_COUNT || m_removedCount > m_entries.size() / 2) {
+        pack();
+    }
+}
+
+//---------------------------------------------------------
+//   items
+//---------------------------------------------------------
+
+std::vector<EngravingItem*> SpatialIndex::items(const RectF& rect) const
+{
+    std::vector<EngravingItem*> result;
+
+    if (!m_cellStarts.empty()) {
+        const int firstColumn = column(std::min(rect.left(), rect.right()));
+        const int lastColumn = column(std::max(rect.left(), rect.right()));
+        const int firstRow = row(std::min(rect.top(), rect.bottom()));
+        const int lastRow = row(std::max(rect.top(), rect.bottom()));
+
+        for (int r = firstRow; r <= lastRow; ++r) {
+            for (int c = firstColumn; c <= lastColumn; ++c) {
+                const size_t cell = static_cast<size_t>(r) * m_columns + c;
+
+                for (uint32_t i = m_cellStarts[cell]; i < m_cellStarts[cell + 1]; ++i) {
+                    const Entry& entry = m_entries[m_cellEntries[i]];
+                    if (!entry.item) {
+                        continue;
+                    }
+
+                    // an item in several cells is reported only by the first of them within the rect
+                    if (c != std::max(entry.firstColumn, firstColumn) || r != std::max(entry.firstRow, firstRow)) {
+                        continue;
+                    }
+
+                    if (entry.rect.intersects(rect)) {
+                        result.push_back(entry.item);
+                    }
+                }
+            }
+        }
+    }
+
+    for (uint32_t idx : m_unpackedEntries) {
+        const Entry& entry = m_entries[idx];
+        if (entry.item && entry.rect.intersects(rect)) {
+            result.push_back(entry.item);
+        }
+    }
+
+    return result;
+}
+
+std::vector<EngravingItem*> SpatialIndex::items(const PointF& pos) const
+{
+    std::vector<EngravingItem*> result;
+
+    const int c = column(pos.x());
+    const int r = row(pos.y());
+
+    if (!m_cellStarts.empty()) {
+        const size_t cell = static_cast<size_t>(r) * m_columns + c;
+
+        for (uint32_t i = m_cellStarts[cell]; i < m_cellStarts[cell + 1]; ++i) {
+            EngravingItem* item = m_entries[m_cellEntries[i]].item;
+            if (item && item->contains(pos)) {
+                result.push_back(item);
+            }
+        }
+    }
+
+    for (uint32_t idx : m_unpackedEntries) {
+        const Entry& entry = m_entries[idx];
+        if (!entry.item) {
+            continue;
+        }
+
+        if (c < entry.firstColumn || c > entry.lastColumn || r < entry.firstRow || r > entry.lastRow) {
+            continue;
+        }
+
+        if (entry.item->contains(pos)) {
+            result.push_back(entry.item);
+        }
+    }
+
+    return result;
+}
+
+//---------------------------------------------------------
+//   size
+//---------------------------------------------------------
+
+size_t SpatialIndex::size() const
+{
+    return m_entries.size() - m_removedCount;
+}
+
+size_t SpatialIndex::cellCount() const
+{
+    return m_cellStarts.empty() ? 0 : m_cellStarts.size() - 1;
+}
+
+//---------------------------------------------------------
+//   updateCellRange
+//---------------------------------------------------------
+
+void SpatialIndex::updateCellRange(Entry& entry) const
+{
+    entry.firstColumn = column(std::min(entry.rect.left(), entry.rect.right()));
+    entry.lastColumn = column(std::max(entry.rect.left(), entry.rect.right()));
+    entry.firstRow = row(std::min(entry.rect.top(), entry.rect.bottom()));
+    entry.lastRow = row(std::max(entry.rect.top(), entry.rect.bottom()));
+}
+
+//---------------------------------------------------------
+//   column
+//    items outside of the index rect go to the border cells
+//---------------------------------------------------------
+
+int SpatialIndex::column(double x) const
+{
+    if (m_cellWidth <= 0.0) {
+        return 0;
+    }
+
+    double c = std::floor((x - m_rect.left()) / m_cellWidth);
+    if (!(c > 0.0)) {
+        return 0;
+    }
+
+    return c < m_columns ? static_cast<int>(c) : m_columns - 1;
+}
+
+int SpatialIndex::row(double y) const
+{
+    if (m_cellHeight <= 0.0) {
+        return 0;
+    }
+
+    double r = std::floor((y - m_rect.top()) / m_cellHeight);
+    if (!(r > 0.0)) {
+        return 0;
+    }
+
+    return r < m_rows ? static_cast<int>(r) : m_rows - 1;
+}
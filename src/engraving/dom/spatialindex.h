@@ -0,0 +1,97 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2023 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef MU_ENGRAVING_SPATIALINDEX_H
+#define MU_ENGRAVING_SPATIALINDEX_H
+
+#include <cstdint>
+#include <vector>
+
+#include "draw/types/geometry.h"
+
+namespace mu::engraving {
+class EngravingItem;
+
+//---------------------------------------------------------
+//   SpatialIndex
+//    uniform grid of the item bounding rects,
+//    packed into contiguous arrays
+//---------------------------------------------------------
+
+//! NOTE The queries are const and do not touch the items (except contains() for a point),
+//! so they may run concurrently. Updates must not run concurrently with anything else.
+//! Items are inserted with a group (ex. the system they belong to),
+//! so that the items of a group can be updated without rebuilding the whole index.
+class SpatialIndex
+{
+public:
+    using Group = const void*;
+
+    void reset(const mu::RectF& rect);
+    void clear();
+
+    void insert(EngravingItem* item, Group group = nullptr);
+    void removeGroup(Group group);
+
+    //! NOTE Sorts the inserted items into the grid, the items which are not packed yet are checked one by one
+    void pack();
+    void packIfNeeded();
+
+    std::vector<EngravingItem*> items(const mu::RectF& rect) const;
+    std::vector<EngravingItem*> items(const mu::PointF& pos) const;
+
+    size_t size() const;
+    size_t cellCount() const;
+
+private:
+    struct Entry {
+        mu::RectF rect;
+        EngravingItem* item = nullptr; // nullptr if removed
+        Group group = nullptr;
+        int firstColumn = 0;
+        int firstRow = 0;
+        int lastColumn = 0;
+        int lastRow = 0;
+    };
+
+    void updateCellRange(Entry& entry) const;
+    int column(double x) const;
+    int row(double y) const;
+
+    mu::RectF m_rect;
+    int m_columns = 1;
+    int m_rows = 1;
+    double m_cellWidth = 0.0;
+    double m_cellHeight = 0.0;
+
+    std::vector<Entry> m_entries;
+
+    // entries of the cell i are m_cellEntries[m_cellStarts[i] .. m_cellStarts[i + 1])
+    std::vector<uint32_t> m_cellStarts;
+    std::vector<uint32_t> m_cellEntries;
+
+    std::vector<uint32_t> m_unpackedEntries;
+    size_t m_removedCount = 0;
+};
+}
+
+#endif // MU_ENGRAVING_SPATIALINDEX_H
@@ -32,6 +32,8 @@
  between startUndo() and endUndo().
 */
 
+#include <typeinfo>
+
 #include "undo.h"
 
 #include "iengravingfont.h"
@@ -147,6 +149,42 @@ void updateNoteLines(Segment* segment, track_idx_t track)
     }
 }
 
+//---------------------------------------------------------
+//   estimatedTreeSize
+//    the items are counted with the size of the base class,
+//    so this is a lower bound of the actual size
+//---------------------------------------------------------
+
+static size_t estimatedTreeSize(const EngravingObject* object)
+{
+    size_t size = sizeof(EngravingItem) + sizeof(EngravingItem::LayoutData);
+
+    if (object->isMeasure()) {
+        //! NOTE Not Measure::scanChildren, it also looks up the spanners and staves of the score
+        for (const Segment* s = toMeasure(object)->first(); s; s = s->next()) {
+            size += sizeof(Segment);
+            for (const EngravingItem* e : s->elist()) {
+                if (e) {
+                    size += estimatedTreeSize(e);
+                }
+            }
+            for (const EngravingItem* e : s->annotations()) {
+                size += estimatedTreeSize(e);
+            }
+        }
+        for (const EngravingItem* e : toMeasure(object)->el()) {
+            size += estimatedTreeSize(e);
+        }
+        return size;
+    }
+
+    for (const EngravingObject* child : object->scanChildren()) {
+        size += estimatedTreeSize(child);
+    }
+
+    return size;
+}
+
 static void updateStaffTextCache(const StaffTextBase* text, Score* score)
 {
     TRACEFUNC;
@@ -271,6 +309,20 @@ void UndoCommand::filterChildren(UndoCommand::Filter f, EngravingItem* target)
     childList = std::move(acceptedList);
 }
 
+//---------------------------------------------------------
+//   computeMemoryUsage
+//---------------------------------------------------------
+
+size_t UndoCommand::computeMemoryUsage() const
+{
+    //! NOTE std::list allocates a node with two pointers for each child
+    size_t size = objectSize() + dataSize();
+    for (const UndoCommand* c : childList) {
+        size += c->computeMemoryUsage() + 2 * sizeof(void*);
+    }
+    return size;
+}
+
 //---------------------------------------------------------
 //   unwind
 //---------------------------------------------------------
@@ -289,6 +341,13 @@ void UndoCommand::unwind()
 //   UndoStack
 //---------------------------------------------------------
 
+static UndoStack::Statistic s_statistic;
+
+const UndoStack::Statistic& UndoStack::statistic()
+{
+    return s_statistic;
+}
+
 UndoStack::UndoStack()
 {
     curCmd   = 0;
@@ -309,6 +368,9 @@ UndoStack::~UndoStack()
         c->cleanup(idx++ < curIdx);
     }
     DeleteAll(list);
+
+    s_statistic.steps -= list.size();
+    s_statistic.memoryUsage -= m_memoryUsage;
 }
 
 bool UndoStack::locked() const
@@ -362,8 +424,17 @@ void UndoStack::push(UndoCommand* cmd, EditData* ed)
         LOG_UNDO() << cmd->name();
     }
 #endif
+    UndoCommand* prevCmd = curCmd->commands().empty() ? nullptr : curCmd->commands().back();
+
     curCmd->appendChild(cmd);
     cmd->redo(ed);
+
+    //! NOTE The check is done after redo, because redo can push other commands
+    if (prevCmd && curCmd->commands().back() == cmd && *std::next(curCmd->commands().rbegin()) == prevCmd
+        && prevCmd->mergeWith(cmd)) {
+        delete curCmd->removeChild();
+        ++s_statistic.mergedCommands;
+    }
 }
 
 //---------------------------------------------------------
@@ -391,27 +462,90 @@ void UndoStack::remove(size_t idx)
     assert(curIdx != mu::nidx);
     // remove redo stack
     while (list.size() > curIdx) {
-        UndoCommand* cmd = mu::takeLast(list);
+        UndoMacro* cmd = mu::takeLast(list);
         stateList.pop_back();
-        cmd->cleanup(false);      // delete elements for which UndoCommand() holds ownership
-        delete cmd;
+        deleteMacro(cmd, false);      // delete elements for which UndoCommand() holds ownership
 //            --curIdx;
     }
     while (list.size() > idx) {
-        UndoCommand* cmd = mu::takeLast(list);
+        UndoMacro* cmd = mu::takeLast(list);
         stateList.pop_back();
-        cmd->cleanup(true);
-        delete cmd;
+        deleteMacro(cmd, true);
     }
     curIdx = idx;
 }
 
+//---------------------------------------------------------
+//   deleteMacro
+//    the macro must be already taken from the list
+//---------------------------------------------------------
+
+void UndoStack::deleteMacro(UndoMacro* cmd, bool undo)
+{
+    m_memoryUsage -= cmd->memoryUsage();
+    s_statistic.memoryUsage -= cmd->memoryUsage();
+    --s_statistic.steps;
+
+    cmd->cleanup(undo);
+    delete cmd;
+}
+
+//---------------------------------------------------------
+//   discardOldest
+//    the oldest step can't be undone anymore
+//---------------------------------------------------------
+
+void UndoStack::discardOldest()
+{
+    assert(curIdx > 0);
+
+    UndoMacro* cmd = mu::takeFirst(list);
+    stateList.erase(stateList.begin());
+    --curIdx;
+    ++m_discardedCount;
+
+    ++s_statistic.discardedSteps;
+    s_statistic.discardedMemoryUsage += cmd->memoryUsage();
+
+    deleteMacro(cmd, true);
+}
+
+//---------------------------------------------------------
+//   discardOverLimits
+//---------------------------------------------------------
+
+void UndoStack::discardOverLimits()
+{
+    // the last step is kept even if it exceeds the limits on its own
+    while (curIdx > 1 && ((m_maxSteps > 0 && list.size() > m_maxSteps) || (m_maxMemory > 0 && m_memoryUsage > m_maxMemory))) {
+        discardOldest();
+    }
+}
+
+//---------------------------------------------------------
+//   setLimits
+//    lower limits are applied at once, unless a command is active
+//---------------------------------------------------------
+
+void UndoStack::setLimits(size_t maxSteps, size_t maxMemory)
+{
+    m_maxSteps = maxSteps;
+    m_maxMemory = maxMemory;
+
+    if (!curCmd) {
+        discardOverLimits();
+    }
+}
+
 //---------------------------------------------------------
 //   mergeCommands
 //---------------------------------------------------------
 
 void UndoStack::mergeCommands(size_t startIdx)
 {
+    //! NOTE The index is from getCurIdx(), the steps before it may have been discarded meanwhile
+    startIdx = startIdx > m_discardedCount ? startIdx - m_discardedCount : 0;
+
     assert(startIdx <= curIdx);
 
     if (startIdx >= list.size()) {
@@ -424,6 +558,12 @@ void UndoStack::mergeCommands(size_t startIdx)
         startMacro->append(std::move(*list[idx]));
     }
     remove(startIdx + 1);   // TODO: remove from startIdx to curIdx only
+
+    m_memoryUsage -= startMacro->memoryUsage();
+    s_statistic.memoryUsage -= startMacro->memoryUsage();
+    startMacro->updateMemoryUsage();
+    m_memoryUsage += startMacro->memoryUsage();
+    s_statistic.memoryUsage += startMacro->memoryUsage();
 }
 
 //---------------------------------------------------------
@@ -461,14 +601,20 @@ void UndoStack::endMacro(bool rollback)
     } else {
         // remove redo stack
         while (list.size() > curIdx) {
-            UndoCommand* cmd = mu::takeLast(list);
+            UndoMacro* cmd = mu::takeLast(list);
             stateList.pop_back();
-            cmd->cleanup(false);        // delete elements for which UndoCommand() holds ownership
-            delete cmd;
+            deleteMacro(cmd, false);        // delete elements for which UndoCommand() holds ownership
         }
+        curCmd->updateMemoryUsage();
+        m_memoryUsage += curCmd->memoryUsage();
+        s_statistic.memoryUsage += curCmd->memoryUsage();
+        ++s_statistic.steps;
+
         list.push_back(curCmd);
         stateList.push_back(nextState++);
         ++curIdx;
+
+        discardOverLimits();
     }
     curCmd = 0;
 }
@@ -489,6 +635,10 @@ void UndoStack::reopen()
     --curIdx;
     curCmd = mu::takeAt(list, curIdx);
     stateList.erase(stateList.begin() + curIdx);
+
+    m_memoryUsage -= curCmd->memoryUsage();
+    s_statistic.memoryUsage -= curCmd->memoryUsage();
+    --s_statistic.steps;
     for (auto i : curCmd->commands()) {
         LOG_UNDO() << "   " << i->name();
     }
@@ -504,7 +654,7 @@ void UndoStack::undo(EditData* ed)
     // Are we currently editing text?
     if (ed && ed->element && ed->element->isTextBase()) {
         TextEditData* ted = static_cast<TextEditData*>(ed->getData(ed->element).get());
-        if (ted && ted->startUndoIdx == curIdx) {
+        if (ted && ted->startUndoIdx == getCurIdx()) {
             // No edits to undo, so do nothing
             return;
         }
@@ -614,6 +764,13 @@ bool UndoMacro::empty() const
     return childCount() == 0;
 }
 
+void UndoMacro::updateMemoryUsage()
+{
+    m_memoryUsage = computeMemoryUsage()
+                    + m_undoSelectionInfo.elements.capacity() * sizeof(EngravingItem*)
+                    + m_redoSelectionInfo.elements.capacity() * sizeof(EngravingItem*);
+}
+
 void UndoMacro::append(UndoMacro&& other)
 {
     appendChildren(&other);
@@ -1004,6 +1161,16 @@ void RemoveElement::cleanup(bool undo)
     }
 }
 
+//---------------------------------------------------------
+//   RemoveElement::dataSize
+//---------------------------------------------------------
+
+size_t RemoveElement::dataSize() const
+{
+    //! NOTE The removed element is owned by the command while it is done
+    return element ? estimatedTreeSize(element) : 0;
+}
+
 //---------------------------------------------------------
 //   undo
 //---------------------------------------------------------
@@ -2164,6 +2331,39 @@ void InsertRemoveMeasures::insertMeasures()
     }
 }
 
+//---------------------------------------------------------
+//   deleteMeasures
+//    the measures must not be in the score
+//---------------------------------------------------------
+
+void InsertRemoveMeasures::deleteMeasures()
+{
+    MeasureBase* mb = fm;
+    while (mb) {
+        MeasureBase* next = mb == lm ? nullptr : mb->next();
+        delete mb;
+        mb = next;
+    }
+    fm = nullptr;
+    lm = nullptr;
+}
+
+//---------------------------------------------------------
+//   measuresDataSize
+//---------------------------------------------------------
+
+size_t InsertRemoveMeasures::measuresDataSize() const
+{
+    size_t size = 0;
+    for (const MeasureBase* mb = fm; mb; mb = mb->next()) {
+        size += estimatedTreeSize(mb);
+        if (mb == lm) {
+            break;
+        }
+    }
+    return size;
+}
+
 //---------------------------------------------------------
 //   removeMeasures
 //---------------------------------------------------------
@@ -2295,6 +2495,18 @@ void InsertRemoveMeasures::removeMeasures()
     score->setLayoutAll();
 }
 
+//---------------------------------------------------------
+//   RemoveMeasures::cleanup
+//---------------------------------------------------------
+
+void RemoveMeasures::cleanup(bool undo)
+{
+    //! NOTE The removed measures are owned by the command while it is done
+    if (undo) {
+        deleteMeasures();
+    }
+}
+
 AddExcerpt::AddExcerpt(Excerpt* ex)
     : excerpt(ex)
 {}
@@ -2562,6 +2774,23 @@ std::vector<const EngravingObject*> ChangeProperty::objectItems() const
     return compoundObjects(element);
 }
 
+//---------------------------------------------------------
+//   ChangeProperty::mergeWith
+//    the property is changed again: undoing this command
+//    restores the value from before both changes
+//---------------------------------------------------------
+
+bool ChangeProperty::mergeWith(const UndoCommand* other)
+{
+    //! NOTE Only commands of the same type, the subclasses do more on flip
+    if (typeid(*this) != typeid(*other)) {
+        return false;
+    }
+
+    const ChangeProperty* cp = static_cast<const ChangeProperty*>(other);
+    return cp->element == element && cp->id == id;
+}
+
 //---------------------------------------------------------
 //   ChangeBracketProperty::flip
 //---------------------------------------------------------
@@ -96,7 +96,8 @@ class TremoloBar;
 enum class PlayEventType : char;
 
 #define UNDO_TYPE(t) CommandType type() const override { return t; }
-#define UNDO_NAME(a) const char* name() const override { return a; }
+#define UNDO_NAME(a) const char* name() const override { return a; } \
+    size_t objectSize() const override { return sizeof(*this); }
 #define UNDO_CHANGED_OBJECTS(...) std::vector<const EngravingObject*> objectItems() const override { return __VA_ARGS__; }
 
 class UndoCommand
@@ -135,6 +136,15 @@ public:
 // #endif
     virtual CommandType type() const { return CommandType::Unknown; }
 
+    //! NOTE Memory accounting of the undo history, the sizes are estimates
+    virtual size_t objectSize() const { return sizeof(UndoCommand); }
+    virtual size_t dataSize() const { return 0; }       // heap data owned or kept alive by the command
+    size_t computeMemoryUsage() const;                  // including the children
+
+    //! NOTE Called with a command pushed right after this one,
+    //! returns true if this command already undoes the other one, so the other one can be dropped
+    virtual bool mergeWith(const UndoCommand*) { return false; }
+
     virtual bool isFiltered(Filter, const EngravingItem* /* target */) const { return false; }
     bool hasFilteredChildren(Filter, const EngravingItem* target) const;
     bool hasUnfilteredChildren(const std::vector<Filter>& filters, const EngravingItem* target) const;
@@ -183,6 +193,9 @@ public:
 
     static bool canRecordSelectedElement(const EngravingItem* e);
 
+    size_t memoryUsage() const { return m_memoryUsage; }
+    void updateMemoryUsage();
+
     UNDO_NAME("UndoMacro")
 
 private:
@@ -193,6 +206,8 @@ private:
 
     Score* m_score = nullptr;
 
+    size_t m_memoryUsage = 0;
+
     static void fillSelectionInfo(SelectionInfo&, const Selection&);
     static void applySelectionInfo(const SelectionInfo&, Selection&);
 };
@@ -207,9 +222,26 @@ class UndoStack
     size_t curIdx = 0;
     bool isLocked = false;
 
+    size_t m_maxSteps = 0;
+    size_t m_maxMemory = 0;
+    size_t m_memoryUsage = 0;
+    size_t m_discardedCount = 0;
+
     void remove(size_t idx);
+    void deleteMacro(UndoMacro* cmd, bool undo);
+    void discardOldest();
+    void discardOverLimits();
+
+public:
+    //! NOTE Totals over all undo stacks
+    struct Statistic {
+        size_t steps = 0;
+        size_t memoryUsage = 0;
+        size_t discardedSteps = 0;
+        size_t discardedMemoryUsage = 0;
+        size_t mergedCommands = 0;
+    };
 
-public:
     UndoStack();
     ~UndoStack();
 
@@ -224,7 +256,8 @@ public:
     bool canUndo() const { return curIdx > 0; }
     bool canRedo() const { return curIdx < list.size(); }
     bool isClean() const { return cleanState == stateList[curIdx]; }
-    size_t getCurIdx() const { return curIdx; }
+    //! NOTE The index counts the discarded steps too, so it stays valid when the oldest steps are discarded
+    size_t getCurIdx() const { return m_discardedCount + curIdx; }
     UndoMacro* current() const { return curCmd; }
     UndoMacro* last() const { return curIdx > 0 ? list[curIdx - 1] : 0; }
     UndoMacro* prev() const { return curIdx > 1 ? list[curIdx - 2] : 0; }
@@ -234,6 +267,15 @@ public:
 
     void mergeCommands(size_t startIdx);
     void cleanRedoStack() { remove(curIdx); }
+
+    //! NOTE The oldest steps are discarded when a new step exceeds the limits, 0 means no limit
+    void setLimits(size_t maxSteps, size_t maxMemory);
+    size_t maxSteps() const { return m_maxSteps; }
+    size_t maxMemory() const { return m_maxMemory; }
+
+    size_t memoryUsage() const { return m_memoryUsage; }
+    size_t discardedCount() const { return m_discardedCount; }
+    static const Statistic& statistic();
 };
 
 class InsertPart : public UndoCommand
@@ -641,6 +683,8 @@ public:
     void cleanup(bool) override;
     const char* name() const override;
 
+    size_t objectSize() const override { return sizeof(*this); }
+
     bool isFiltered(UndoCommand::Filter f, const EngravingItem* target) const override;
 
     std::vector<const EngravingObject*> objectItems() const override;
@@ -661,6 +705,9 @@ public:
     void cleanup(bool) override;
     const char* name() const override;
 
+    size_t objectSize() const override { return sizeof(*this); }
+    size_t dataSize() const override;
+
     bool isFiltered(UndoCommand::Filter f, const EngravingItem* target) const override;
 
     UNDO_TYPE(CommandType::RemoveElement)
@@ -897,6 +944,8 @@ class InsertRemoveMeasures : public UndoCommand
 protected:
     void removeMeasures();
     void insertMeasures();
+    void deleteMeasures();
+    size_t measuresDataSize() const;
 
 public:
     InsertRemoveMeasures(MeasureBase* _fm, MeasureBase* _lm)
@@ -914,6 +963,8 @@ public:
         : InsertRemoveMeasures(m1, m2) {}
     void undo(EditData*) override { insertMeasures(); }
     void redo(EditData*) override { removeMeasures(); }
+    void cleanup(bool undo) override;
+    size_t dataSize() const override { return measuresDataSize(); }
 
     UNDO_TYPE(CommandType::RemoveMeasures)
     UNDO_NAME("RemoveMeasures")
@@ -1132,6 +1183,9 @@ public:
 
     std::vector<const EngravingObject*> objectItems() const override;
 
+    size_t dataSize() const override { return property.dataSize(); }
+    bool mergeWith(const UndoCommand* other) override;
+
     bool isFiltered(UndoCommand::Filter f, const EngravingItem* target) const override
     {
         return f == UndoCommand::Filter::ChangePropertyLinked && mu::contains(target->linkList(), element);
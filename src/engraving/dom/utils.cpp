@@ -22,6 +22,7 @@
 
 #include "utils.h"
 
+#include <algorithm>
 #include <cmath>
 #include <map>
 
@@ -71,15 +72,19 @@ Measure* Score::tick2measure(const Fraction& tick) const
         return firstMeasure();
     }
 
-    Measure* lm = 0;
-    for (Measure* m = firstMeasure(); m; m = m->nextMeasure()) {
-        if (tick < m->tick()) {
-            assert(lm);
-            return lm;
-        }
-        lm = m;
+    // binary search for the last measure starting at or before tick
+    const std::vector<Measure*>& measures = m_measures.measureIndex();
+    auto it = std::upper_bound(measures.begin(), measures.end(), tick, [](const Fraction& t, const Measure* m) {
+        return t < m->tick();
+    });
+
+    if (it != measures.end()) {
+        assert(it != measures.begin());
+        return it != measures.begin() ? *(it - 1) : nullptr;
     }
+
     // check last measure
+    Measure* lm = measures.empty() ? nullptr : measures.back();
     if (lm && (tick >= lm->tick()) && (tick <= lm->endTick())) {
         return lm;
     }
@@ -101,6 +106,22 @@ Measure* Score::tick2measureMM(const Fraction& t) const
         tick = Fraction(0, 1);
     }
 
+    if (!style().styleB(Sid::createMultiMeasureRests)) {
+        return tick2measure(tick);
+    }
+
+    //! NOTE Find the measure by the index and take the mmrest covering it,
+    //! if it is the one in the MM chain
+    if (Measure* m = tick2measure(tick)) {
+        Measure* mm = const_cast<Measure*>(m->coveringMMRestOrThis());
+        if (mm == m) {
+            return m;
+        }
+        if (mm && mm->mmRestFirst()->mmRest() == mm && tick >= mm->tick() && tick <= mm->endTick()) {
+            return mm;
+        }
+    }
+
     Measure* lm = 0;
 
     for (Measure* m = firstMeasureMM(); m; m = m->nextMeasureMM()) {
@@ -117,6 +117,8 @@ void EngravingModule::onInit(const framework::IApplication::RunMode& mode)
         // Symbols
         Smufl::init();
 
+        m_engravingfonts->setMetricsCacheDirPath(m_configuration->fontMetricsCachePath());
+
         m_engravingfonts->addFont("Leland",     "Leland",      ":/fonts/leland/Leland.otf");
         m_engravingfonts->addFont("Bravura",    "Bravura",     ":/fonts/bravura/Bravura.otf");
         m_engravingfonts->addFont("Emmentaler", "MScore",      ":/fonts/mscore/mscore.ttf");
@@ -22,6 +22,8 @@
 #ifndef MU_ENGRAVING_IENGRAVINGCONFIGURATION_H
 #define MU_ENGRAVING_IENGRAVINGCONFIGURATION_H
 
+#include <optional>
+
 #include "types/string.h"
 #include "io/path.h"
 #include "modularity/imoduleinterface.h"
@@ -41,6 +43,7 @@ public:
     virtual ~IEngravingConfiguration() = default;
 
     virtual io::path_t appDataPath() const = 0;
+    virtual io::path_t fontMetricsCachePath() const = 0;
 
     virtual io::path_t defaultStyleFilePath() const = 0;
     virtual void setDefaultStyleFilePath(const io::path_t& path) = 0;
@@ -116,6 +119,11 @@ public:
     virtual void setGuitarProMultivoiceEnabled(bool multiVoice) = 0;
     virtual bool guitarProMultivoiceEnabled() const = 0;
     virtual bool minDistanceForPartialSkylineCalculated() const = 0;
+
+    //! NOTE Limits of the undo history of a score, 0 means no limit
+    virtual size_t undoHistoryMaxSteps() const = 0;
+    virtual size_t undoHistoryMaxMemory() const = 0; // bytes
+    virtual async::Notification undoHistoryLimitsChanged() const = 0;
 };
 }
 
@@ -25,6 +25,9 @@ public:
     virtual bool isFallbackFont(const IEngravingFont* f) const = 0;
 
     virtual void loadAllFonts() = 0;
+
+    //! NOTE Directory for the symbol metrics of the fonts, they are computed only once if set
+    virtual void setMetricsCacheDirPath(const io::path_t& dirPath) = 0;
 };
 }
 
@@ -92,7 +92,21 @@ public:
 
     void set_value(const T& v)
     {
-        m_val = std::make_optional<T>(v);
+        //! NOTE Assign to the existing value, so that its storage is reused
+        if (m_val.has_value()) {
+            m_val.value() = v;
+        } else {
+            m_val.emplace(v);
+        }
+    }
+
+    void set_value(T&& v)
+    {
+        if (m_val.has_value()) {
+            m_val.value() = std::move(v);
+        } else {
+            m_val.emplace(std::move(v));
+        }
     }
 
 private:
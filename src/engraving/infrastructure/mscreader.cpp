@@ -22,6 +22,7 @@
 #include "mscreader.h"
 
 #include "io/file.h"
+#include "io/mappedfile.h"
 #include "io/fileinfo.h"
 #include "io/dir.h"
 #include "serialization/zipreader.h"
@@ -263,7 +264,8 @@ Ret MscReader::ZipFileReader::open(IODevice* device, const path_t& filePath)
             return make_ret(Err::FileNotFound, filePath);
         }
 
-        m_device = new File(filePath);
+        //! NOTE The container is mapped, not read, so only the entries that are actually requested are touched
+        m_device = new MappedFile(filePath);
         m_selfDeviceOwner = true;
     }
 
@@ -22,10 +22,14 @@
 
 #include "shape.h"
 
+#include <memory>
+
 #include "draw/painter.h"
 
 #include "dom/engravingitem.h"
 
+#include "shapekernels.h"
+
 #include "log.h"
 
 using namespace mu;
@@ -87,9 +91,10 @@ void Shape::translateY(double yo)
 
 Shape Shape::translated(const PointF& pt) const
 {
-    Shape s;
+    Shape s(m_type);
+    s.m_elements.reserve(m_elements.size());
     for (const ShapeElement& r : m_elements) {
-        s.add(r.translated(pt), r.item());
+        s.m_elements.emplace_back(r.translated(pt), r.item());
     }
     return s;
 }
@@ -142,6 +147,28 @@ std::optional<ShapeElement> Shape::get_first() const
     return std::make_optional(m_elements.at(0));
 }
 
+//-------------------------------------------------------------------
+//   verticalDistanceColumns
+//    The rects of the shape which are able to collide vertically,
+//    i.e. which have a height and a width.
+//    The columns are reused by the next call on the same thread.
+//-------------------------------------------------------------------
+
+static const shapekernels::Columns& verticalDistanceColumns(const std::vector<ShapeElement>& elements)
+{
+    static thread_local shapekernels::Columns columns;
+
+    columns.clear();
+    for (const RectF& r : elements) {
+        if (r.height() <= 0.0 || r.left() == r.right()) {
+            continue;
+        }
+        columns.push_back(r.left(), r.right(), r.top(), r.bottom());
+    }
+
+    return columns;
+}
+
 //-------------------------------------------------------------------
 //   minVerticalDistance
 //    a is located below this shape.
@@ -154,6 +181,8 @@ double Shape::minVerticalDistance(const Shape& a) const
         return 0.0;
     }
 
+    const shapekernels::Columns& columns = verticalDistanceColumns(m_elements);
+
     double dist = -1000000.0; // min real
     for (const RectF& r2 : a.m_elements) {
         if (r2.height() <= 0.0) {
@@ -161,16 +190,10 @@ double Shape::minVerticalDistance(const Shape& a) const
         }
         double bx1 = r2.left();
         double bx2 = r2.right();
-        for (const RectF& r1 : m_elements) {
-            if (r1.height() <= 0.0) {
-                continue;
-            }
-            double ax1 = r1.left();
-            double ax2 = r1.right();
-            if (mu::engraving::intersects(ax1, ax2, bx1, bx2, 0.0)) {
-                dist = std::max(dist, r1.bottom() - r2.top());
-            }
+        if (bx1 == bx2) {
+            continue;
         }
+        dist = shapekernels::maxBottomDistance(columns, bx1, bx2, r2.top(), dist);
     }
     return dist;
 }
@@ -189,6 +212,8 @@ double Shape::verticalClearance(const Shape& a, double minHorizontalDistance) co
         return 0.0;
     }
 
+    const shapekernels::Columns& columns = verticalDistanceColumns(m_elements);
+
     double dist = 1000000.0; // max real
     for (const RectF& r2 : a.m_elements) {
         if (r2.height() <= 0.0) {
@@ -196,16 +221,10 @@ double Shape::verticalClearance(const Shape& a, double minHorizontalDistance) co
         }
         double bx1 = r2.left() - minHorizontalDistance;
         double bx2 = r2.right() + minHorizontalDistance;
-        for (const RectF& r1 : m_elements) {
-            if (r1.height() <= 0.0) {
-                continue;
-            }
-            double ax1 = r1.left();
-            double ax2 = r1.right();
-            if (mu::engraving::intersects(ax1, ax2, bx1, bx2, 0.0)) {
-                dist = std::min(dist, r2.top() - r1.bottom());
-            }
+        if (bx1 == bx2) {
+            continue;
         }
+        dist = shapekernels::minTopClearance(columns, bx1, bx2, r2.top(), dist);
     }
     return dist;
 }
@@ -393,6 +412,15 @@ void Shape::add(const Shape& s)
     invalidateBBox();
 }
 
+void Shape::add(const Shape& s, const PointF& offset)
+{
+    m_type = Type::Composite;
+    for (const ShapeElement& r : s.m_elements) {
+        m_elements.emplace_back(r.translated(offset), r.item());
+    }
+    invalidateBBox();
+}
+
 void Shape::add(const RectF& r, const EngravingItem* p)
 {
     m_type = Type::Composite;
@@ -491,6 +519,35 @@ void Shape::paint(Painter& painter) const
     }
 }
 
+//---------------------------------------------------------
+//   ScratchShape
+//---------------------------------------------------------
+
+struct ScratchShapePool {
+    std::vector<std::unique_ptr<Shape> > shapes;
+    size_t used = 0;
+};
+
+static thread_local ScratchShapePool s_scratchShapePool;
+
+ScratchShape::ScratchShape()
+{
+    //! NOTE Scratch shapes may be nested (filling a shape may require filling the shapes of its children),
+    //! so every living one takes its own pool entry
+    ScratchShapePool& pool = s_scratchShapePool;
+    if (pool.used == pool.shapes.size()) {
+        pool.shapes.push_back(std::make_unique<Shape>(Shape::Type::Composite));
+    }
+
+    m_shape = pool.shapes[pool.used++].get();
+    m_shape->clear();
+}
+
+ScratchShape::~ScratchShape()
+{
+    --s_scratchShapePool.used;
+}
+
 #ifndef NDEBUG
 //---------------------------------------------------------
 //   dump
@@ -83,7 +83,8 @@ public:
 
     size_t size() const { return m_elements.size(); }
     bool empty() const { return m_elements.empty(); }
-    void clear() { m_elements.clear(); }
+    void clear() { m_elements.clear(); invalidateBBox(); }
+    void reserve(size_t n) { m_elements.reserve(n); }
 
     bool equal(const Shape& sh) const
     {
@@ -105,6 +106,7 @@ public:
 
     // Composite
     void add(const Shape& s);
+    void add(const Shape& s, const mu::PointF& offset);
     void add(const mu::RectF& r, const EngravingItem* p);
     void add(const mu::RectF& r);
 
@@ -167,6 +169,29 @@ private:
     mutable RectF m_bbox;   // cache
 };
 
+//---------------------------------------------------------
+//   ScratchShape
+//    A composite shape for temporary use during layout.
+//    Its storage comes from a per thread pool and is kept
+//    between uses, so composing it doesn't allocate.
+//---------------------------------------------------------
+
+class ScratchShape
+{
+public:
+    ScratchShape();
+    ~ScratchShape();
+
+    ScratchShape(const ScratchShape&) = delete;
+    ScratchShape& operator=(const ScratchShape&) = delete;
+
+    Shape& operator*() { return *m_shape; }
+    Shape* operator->() { return m_shape; }
+
+private:
+    Shape* m_shape = nullptr;
+};
+
 //---------------------------------------------------------
 //   intersects
 //---------------------------------------------------------
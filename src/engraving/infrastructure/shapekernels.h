@@ -0,0 +1,191 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2023 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef MU_ENGRAVING_SHAPEKERNELS_H
+#define MU_ENGRAVING_SHAPEKERNELS_H
+
+#include <cstddef>
+#include <vector>
+
+#if defined(__SSE2__) || defined(_M_AMD64) || defined(_M_X64)
+#include <emmintrin.h>
+#define MU_ENGRAVING_SHAPE_SSE2
+#elif defined(__aarch64__) || defined(_M_ARM64)
+#include <arm_neon.h>
+#define MU_ENGRAVING_SHAPE_NEON
+#endif
+
+/*
+  Distance kernels over the shape rects, stored as structure of arrays.
+  The vector code takes exactly the same decisions as the scalar one
+  (including NaN and the order of the comparisons), so the results do not depend on the platform.
+ */
+
+namespace mu::engraving::shapekernels {
+//---------------------------------------------------------
+//   Columns
+//    x1 = left, x2 = right, y1 = top, y2 = bottom
+//---------------------------------------------------------
+
+struct Columns {
+    std::vector<double> x1;
+    std::vector<double> x2;
+    std::vector<double> y1;
+    std::vector<double> y2;
+
+    size_t size() const { return x1.size(); }
+
+    void clear()
+    {
+        x1.clear();
+        x2.clear();
+        y1.clear();
+        y2.clear();
+    }
+
+    void push_back(double left, double right, double top, double bottom)
+    {
+        x1.push_back(left);
+        x2.push_back(right);
+        y1.push_back(top);
+        y2.push_back(bottom);
+    }
+};
+
+//---------------------------------------------------------
+//   maxBottomDistance
+//    max(dist, y2[i] - top) over i where x2[i] > left && x1[i] < right
+//---------------------------------------------------------
+
+inline double maxBottomDistance(const Columns& c, double left, double right, double top, double dist)
+{
+    const size_t n = c.size();
+    size_t i = 0;
+
+#if defined(MU_ENGRAVING_SHAPE_SSE2)
+    if (n >= 2) {
+        const __m128d vleft = _mm_set1_pd(left);
+        const __m128d vright = _mm_set1_pd(right);
+        const __m128d vtop = _mm_set1_pd(top);
+        __m128d vdist = _mm_set1_pd(dist);
+
+        for (; i + 2 <= n; i += 2) {
+            __m128d hit = _mm_and_pd(_mm_cmpgt_pd(_mm_loadu_pd(&c.x2[i]), vleft), _mm_cmplt_pd(_mm_loadu_pd(&c.x1[i]), vright));
+            __m128d cand = _mm_sub_pd(_mm_loadu_pd(&c.y2[i]), vtop);
+            __m128d take = _mm_and_pd(hit, _mm_cmplt_pd(vdist, cand));
+            vdist = _mm_or_pd(_mm_and_pd(take, cand), _mm_andnot_pd(take, vdist));
+        }
+
+        double lanes[2];
+        _mm_storeu_pd(lanes, vdist);
+        dist = lanes[0] < lanes[1] ? lanes[1] : lanes[0];
+    }
+#elif defined(MU_ENGRAVING_SHAPE_NEON)
+    if (n >= 2) {
+        const float64x2_t vleft = vdupq_n_f64(left);
+        const float64x2_t vright = vdupq_n_f64(right);
+        const float64x2_t vtop = vdupq_n_f64(top);
+        float64x2_t vdist = vdupq_n_f64(dist);
+
+        for (; i + 2 <= n; i += 2) {
+            uint64x2_t hit = vandq_u64(vcgtq_f64(vld1q_f64(&c.x2[i]), vleft), vcltq_f64(vld1q_f64(&c.x1[i]), vright));
+            float64x2_t cand = vsubq_f64(vld1q_f64(&c.y2[i]), vtop);
+            uint64x2_t take = vandq_u64(hit, vcltq_f64(vdist, cand));
+            vdist = vbslq_f64(take, cand, vdist);
+        }
+
+        double lane0 = vgetq_lane_f64(vdist, 0);
+        double lane1 = vgetq_lane_f64(vdist, 1);
+        dist = lane0 < lane1 ? lane1 : lane0;
+    }
+#endif
+
+    for (; i < n; ++i) {
+        if (c.x2[i] > left && c.x1[i] < right) {
+            double cand = c.y2[i] - top;
+            dist = dist < cand ? cand : dist;
+        }
+    }
+
+    return dist;
+}
+
+//---------------------------------------------------------
+//   minTopClearance
+//    min(dist, top - y2[i]) over i where x2[i] > left && x1[i] < right
+//---------------------------------------------------------
+
+inline double minTopClearance(const Columns& c, double left, double right, double top, double dist)
+{
+    const size_t n = c.size();
+    size_t i = 0;
+
+#if defined(MU_ENGRAVING_SHAPE_SSE2)
+    if (n >= 2) {
+        const __m128d vleft = _mm_set1_pd(left);
+        const __m128d vright = _mm_set1_pd(right);
+        const __m128d vtop = _mm_set1_pd(top);
+        __m128d vdist = _mm_set1_pd(dist);
+
+        for (; i + 2 <= n; i += 2) {
+            __m128d hit = _mm_and_pd(_mm_cmpgt_pd(_mm_loadu_pd(&c.x2[i]), vleft), _mm_cmplt_pd(_mm_loadu_pd(&c.x1[i]), vright));
+            __m128d cand = _mm_sub_pd(vtop, _mm_loadu_pd(&c.y2[i]));
+            __m128d take = _mm_and_pd(hit, _mm_cmplt_pd(cand, vdist));
+            vdist = _mm_or_pd(_mm_and_pd(take, cand), _mm_andnot_pd(take, vdist));
+        }
+
+        double lanes[2];
+        _mm_storeu_pd(lanes, vdist);
+        dist = lanes[1] < lanes[0] ? lanes[1] : lanes[0];
+    }
+#elif defined(MU_ENGRAVING_SHAPE_NEON)
+    if (n >= 2) {
+        const float64x2_t vleft = vdupq_n_f64(left);
+        const float64x2_t vright = vdupq_n_f64(right);
+        const float64x2_t vtop = vdupq_n_f64(top);
+        float64x2_t vdist = vdupq_n_f64(dist);
+
+        for (; i + 2 <= n; i += 2) {
+            uint64x2_t hit = vandq_u64(vcgtq_f64(vld1q_f64(&c.x2[i]), vleft), vcltq_f64(vld1q_f64(&c.x1[i]), vright));
+            float64x2_t cand = vsubq_f64(vtop, vld1q_f64(&c.y2[i]));
+            uint64x2_t take = vandq_u64(hit, vcltq_f64(cand, vdist));
+            vdist = vbslq_f64(take, cand, vdist);
+        }
+
+        double lane0 = vgetq_lane_f64(vdist, 0);
+        double lane1 = vgetq_lane_f64(vdist, 1);
+        dist = lane1 < lane0 ? lane1 : lane0;
+    }
+#endif
+
+    for (; i < n; ++i) {
+        if (c.x2[i] > left && c.x1[i] < right) {
+            double cand = top - c.y2[i];
+            dist = cand < dist ? cand : dist;
+        }
+    }
+
+    return dist;
+}
+}
+
+#endif // MU_ENGRAVING_SHAPEKERNELS_H
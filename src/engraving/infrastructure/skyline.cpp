@@ -65,19 +65,13 @@ void Skyline::add(const ShapeElement& r)
             bool isCross = (beam && beam->cross())
                            || (tremolo && tremolo->twoNotes() && tremolo->chord1()->staffMove() != tremolo->chord2()->staffMove());
             if (isCross) {
-                std::vector<ChordRest*> elements;
-                if (beam) {
-                    elements = beam->elements();
-                } else if (tremolo) {
-                    elements = { tremolo->chord1(), tremolo->chord2() };
-                }
                 int thisStaffMove = chord->staffMove();
                 if (thisStaffMove < 0) {
                     crossNorth = true;
                 } else if (thisStaffMove > 0) {
                     crossSouth = true;
                 }
-                for (ChordRest* element : elements) {
+                auto checkStaffMove = [thisStaffMove, &crossNorth, &crossSouth](const ChordRest* element) {
                     int staffMove = element->staffMove();
                     if (staffMove < thisStaffMove) {
                         crossNorth = true;
@@ -85,6 +79,14 @@ void Skyline::add(const ShapeElement& r)
                     if (staffMove > thisStaffMove) {
                         crossSouth = true;
                     }
+                };
+                if (beam) {
+                    for (const ChordRest* element : beam->elements()) {
+                        checkStaffMove(element);
+                    }
+                } else if (tremolo) {
+                    checkStaffMove(tremolo->chord1());
+                    checkStaffMove(tremolo->chord2());
                 }
             }
         }
@@ -156,6 +158,13 @@ void SkylineLine::add(const Shape& s)
     }
 }
 
+void SkylineLine::add(const Shape& s, const PointF& offset)
+{
+    for (const ShapeElement& r : s.elements()) {
+        add(ShapeElement(r.translated(offset), r.item()));
+    }
+}
+
 void SkylineLine::add(const ShapeElement& r)
 {
     if (north) {
@@ -172,6 +181,13 @@ void Skyline::add(const Shape& s)
     }
 }
 
+void Skyline::add(const Shape& s, const PointF& offset)
+{
+    for (const ShapeElement& r : s.elements()) {
+        add(ShapeElement(r.translated(offset), r.item()));
+    }
+}
+
 void SkylineLine::add(double x, double y, double w)
 {
 //      assert(w >= 0.0);
@@ -186,6 +202,7 @@ void SkylineLine::add(double x, double y, double w)
     DP("===add  %f %f %f\n", x, y, w);
 
     SegIter i = find(x);
+    invalidateCache(i - seg.begin());
     double cx = seg.empty() ? 0.0 : i->x;
     for (; i != seg.end(); ++i) {
         double cy = i->y;
@@ -266,6 +283,105 @@ void Skyline::clear()
     _south.clear();
 }
 
+void SkylineLine::clear()
+{
+    seg.clear();
+    invalidateCache(0);
+}
+
+//---------------------------------------------------------
+//   updateCache
+//    Caches the x of the segments, summed up from the widths
+//    in the same order as the merge in minDistance() does,
+//    so the results don't change, and the minimum and
+//    maximum y of each block of segments.
+//    Only the segments up to x are done, and the values are
+//    kept until a segment before them changes, as the
+//    skyline is usually queried and extended alternately.
+//---------------------------------------------------------
+
+static constexpr size_t SEG_BLOCK_SIZE = 32;
+
+void SkylineLine::invalidateCache(size_t segIdx)
+{
+    segXValidCount = std::min(segXValidCount, segIdx + 1);
+    blockValidCount = std::min(blockValidCount, segIdx / SEG_BLOCK_SIZE);
+}
+
+void SkylineLine::updateCache(double x) const
+{
+    segX.resize(seg.size() + 1);
+    if (segXValidCount == 0) {
+        segX[0] = 0.0;
+        segXValidCount = 1;
+        segXSorted = true;
+    }
+
+    size_t j = segXValidCount - 1;
+    for (; j < seg.size() && segX[j] <= x; ++j) {
+        segX[j + 1] = segX[j] + seg[j].w;
+        segXSorted = segXSorted && seg[j].w >= 0.0;
+    }
+    segXValidCount = j + 1;
+
+    blockMinY.resize((seg.size() + SEG_BLOCK_SIZE - 1) / SEG_BLOCK_SIZE);
+    blockMaxY.resize(blockMinY.size());
+    for (; (blockValidCount + 1) * SEG_BLOCK_SIZE <= j; ++blockValidCount) {
+        double minValue = MAXIMUM_Y;
+        double maxValue = MINIMUM_Y;
+        for (size_t k = blockValidCount * SEG_BLOCK_SIZE; k < (blockValidCount + 1) * SEG_BLOCK_SIZE; ++k) {
+            minValue = std::min(minValue, seg[k].y);
+            maxValue = std::max(maxValue, seg[k].y);
+        }
+        blockMinY[blockValidCount] = minValue;
+        blockMaxY[blockValidCount] = maxValue;
+    }
+}
+
+//---------------------------------------------------------
+//   overlappedSegments
+//    The range of the segments, which overlap x1..x2.
+//    The cache must be sorted and done up to x2.
+//---------------------------------------------------------
+
+std::pair<size_t, size_t> SkylineLine::overlappedSegments(double x1, double x2) const
+{
+    size_t done = segXValidCount - 1;
+    size_t from = std::upper_bound(segX.begin() + 1, segX.begin() + done + 1, x1) - (segX.begin() + 1);
+    size_t to = std::lower_bound(segX.begin(), segX.begin() + std::min(done + 1, seg.size()), x2) - segX.begin();
+    return { from, std::max(from, to) };
+}
+
+double SkylineLine::minY(size_t from, size_t to) const
+{
+    double val = MAXIMUM_Y;
+    for (; from < to && from % SEG_BLOCK_SIZE != 0; ++from) {
+        val = std::min(val, seg[from].y);
+    }
+    for (; from + SEG_BLOCK_SIZE <= to && from / SEG_BLOCK_SIZE < blockValidCount; from += SEG_BLOCK_SIZE) {
+        val = std::min(val, blockMinY[from / SEG_BLOCK_SIZE]);
+    }
+    for (; from < to; ++from) {
+        val = std::min(val, seg[from].y);
+    }
+    return val;
+}
+
+double SkylineLine::maxY(size_t from, size_t to) const
+{
+    double val = MINIMUM_Y;
+    for (; from < to && from % SEG_BLOCK_SIZE != 0; ++from) {
+        val = std::max(val, seg[from].y);
+    }
+    for (; from + SEG_BLOCK_SIZE <= to && from / SEG_BLOCK_SIZE < blockValidCount; from += SEG_BLOCK_SIZE) {
+        val = std::max(val, blockMaxY[from / SEG_BLOCK_SIZE]);
+    }
+    for (; from < to; ++from) {
+        val = std::max(val, seg[from].y);
+    }
+    return val;
+}
+
 //-------------------------------------------------------------------
 //   minDistance
 //    a is located below this skyline.
@@ -278,6 +394,59 @@ double Skyline::minDistance(const Skyline& s) const
 }
 
 double SkylineLine::minDistance(const SkylineLine& sl) const
+{
+    //! NOTE Lines of about the same length, like the ones of two staves, are merged in one go,
+    //! for a short one, like the one of an item to autoplace, the overlapped segments are looked up
+    if (seg.size() * SEG_BLOCK_SIZE <= sl.seg.size()) {
+        return rangedMinDistance(*this, sl, true);
+    } else if (sl.seg.size() * SEG_BLOCK_SIZE <= seg.size()) {
+        return rangedMinDistance(sl, *this, false);
+    }
+    return mergedMinDistance(sl);
+}
+
+//---------------------------------------------------------
+//   rangedMinDistance
+//    When the segments are sorted, the merge visits every
+//    overlapping pair of segments, so the result is the
+//    maximum over these pairs. The difference is monotonic
+//    in each y, so taking the minimum or maximum y of the
+//    overlapped range first gives exactly the same result.
+//---------------------------------------------------------
+
+double SkylineLine::rangedMinDistance(const SkylineLine& shortLine, const SkylineLine& longLine, bool shortOnTop)
+{
+    double end = 0.0;
+    for (const SkylineSegment& s : shortLine.seg) {
+        if (!(s.w >= 0.0)) {
+            return shortOnTop ? shortLine.mergedMinDistance(longLine) : longLine.mergedMinDistance(shortLine);
+        }
+        end += s.w;
+    }
+
+    longLine.updateCache(end);
+    if (!longLine.segXSorted) {
+        return shortOnTop ? shortLine.mergedMinDistance(longLine) : longLine.mergedMinDistance(shortLine);
+    }
+
+    double dist = MINIMUM_Y;
+    double x1 = 0.0;
+    for (const SkylineSegment& s : shortLine.seg) {
+        double x2 = x1 + s.w;
+        std::pair<size_t, size_t> range = longLine.overlappedSegments(x1, x2);
+        if (range.first < range.second) {
+            if (shortOnTop) {
+                dist = std::max(dist, s.y - longLine.minY(range.first, range.second));
+            } else {
+                dist = std::max(dist, longLine.maxY(range.first, range.second) - s.y);
+            }
+        }
+        x1 = x2;
+    }
+    return dist;
+}
+
+double SkylineLine::mergedMinDistance(const SkylineLine& sl) const
 {
     double dist = MINIMUM_Y;
 
@@ -56,6 +56,14 @@ class SkylineLine
 {
     const bool north;
     std::vector<SkylineSegment> seg;
+
+    // cache for minDistance(), see updateCache()
+    mutable std::vector<double> segX;
+    mutable std::vector<double> blockMinY;
+    mutable std::vector<double> blockMaxY;
+    mutable size_t segXValidCount = 0;
+    mutable size_t blockValidCount = 0;
+    mutable bool segXSorted = true;
     typedef std::vector<SkylineSegment>::iterator SegIter;
     typedef std::vector<SkylineSegment>::const_iterator SegConstIter;
 
@@ -64,15 +72,24 @@ class SkylineLine
     SegIter find(double x);
     SegConstIter find(double x) const;
 
+    void invalidateCache(size_t segIdx);
+    void updateCache(double x) const;
+    std::pair<size_t, size_t> overlappedSegments(double x1, double x2) const;
+    double minY(size_t from, size_t to) const;
+    double maxY(size_t from, size_t to) const;
+    double mergedMinDistance(const SkylineLine&) const;
+    static double rangedMinDistance(const SkylineLine& shortLine, const SkylineLine& longLine, bool shortOnTop);
+
 public:
     SkylineLine(bool n)
         : north(n) {}
     void add(const Shape& s);
+    void add(const Shape& s, const PointF& offset);
     void add(const ShapeElement& r);
     void add(double x, double y, double w);
     void add(const RectF& r) { add(ShapeElement(r)); }
 
-    void clear() { seg.clear(); }
+    void clear();
     void paint(mu::draw::Painter& painter) const;
     void dump() const;
     double minDistance(const SkylineLine&) const;
@@ -102,6 +119,7 @@ public:
 
     void clear();
     void add(const Shape& s);
+    void add(const Shape& s, const PointF& offset);
     void add(const ShapeElement& r);
     void add(const RectF& r) { add(ShapeElement(r)); }
 
@@ -44,6 +44,9 @@ static const Settings::Key PART_STYLE_FILE_PATH("engraving", "engraving/style/pa
 
 static const Settings::Key INVERT_SCORE_COLOR("engraving", "engraving/scoreColorInversion");
 
+static const Settings::Key UNDO_HISTORY_MAX_STEPS("engraving", "engraving/undo/maxSteps");
+static const Settings::Key UNDO_HISTORY_MAX_MEMORY_MB("engraving", "engraving/undo/maxMemoryMb");
+
 struct VoiceColor {
     Settings::Key key;
     Color color;
@@ -67,6 +70,21 @@ void EngravingConfiguration::init()
         m_scoreInversionChanged.notify();
     });
 
+    settings()->setDefaultValue(UNDO_HISTORY_MAX_STEPS, Val(0));
+    settings()->setDescription(UNDO_HISTORY_MAX_STEPS, qtrc("engraving", "Maximum number of undo steps (0 - unlimited)").toStdString());
+    settings()->setCanBeManuallyEdited(UNDO_HISTORY_MAX_STEPS, true, Val(0), Val(100000));
+    settings()->valueChanged(UNDO_HISTORY_MAX_STEPS).onReceive(nullptr, [this](const Val&) {
+        m_undoHistoryLimitsChanged.notify();
+    });
+
+    settings()->setDefaultValue(UNDO_HISTORY_MAX_MEMORY_MB, Val(256));
+    settings()->setDescription(UNDO_HISTORY_MAX_MEMORY_MB,
+                               qtrc("engraving", "Maximum memory of the undo history in MB (0 - unlimited)").toStdString());
+    settings()->setCanBeManuallyEdited(UNDO_HISTORY_MAX_MEMORY_MB, true, Val(0), Val(16384));
+    settings()->valueChanged(UNDO_HISTORY_MAX_MEMORY_MB).onReceive(nullptr, [this](const Val&) {
+        m_undoHistoryLimitsChanged.notify();
+    });
+
     for (voice_idx_t voice = 0; voice < VOICES; ++voice) {
         Settings::Key key("engraving", "engraving/colors/voice" + std::to_string(voice + 1));
 
@@ -89,6 +107,16 @@ mu::io::path_t EngravingConfiguration::appDataPath() const
     return globalConfiguration()->appDataPath();
 }
 
+mu::io::path_t EngravingConfiguration::fontMetricsCachePath() const
+{
+    mu::io::path_t userAppDataPath = globalConfiguration()->userAppDataPath();
+    if (userAppDataPath.empty()) {
+        return mu::io::path_t();
+    }
+
+    return userAppDataPath + "/font_metrics";
+}
+
 mu::io::path_t EngravingConfiguration::defaultStyleFilePath() const
 {
     return settings()->value(DEFAULT_STYLE_FILE_PATH).toPath();
@@ -324,3 +352,18 @@ bool EngravingConfiguration::minDistanceForPartialSkylineCalculated() const
 {
     return guitarProImportExperimental();
 }
+
+size_t EngravingConfiguration::undoHistoryMaxSteps() const
+{
+    return static_cast<size_t>(std::max(settings()->value(UNDO_HISTORY_MAX_STEPS).toInt(), 0));
+}
+
+size_t EngravingConfiguration::undoHistoryMaxMemory() const
+{
+    return static_cast<size_t>(std::max(settings()->value(UNDO_HISTORY_MAX_MEMORY_MB).toInt(), 0)) * 1024 * 1024;
+}
+
+mu::async::Notification EngravingConfiguration::undoHistoryLimitsChanged() const
+{
+    return m_undoHistoryLimitsChanged;
+}
@@ -46,6 +46,7 @@ public:
     void init();
 
     io::path_t appDataPath() const override;
+    io::path_t fontMetricsCachePath() const override;
 
     io::path_t defaultStyleFilePath() const override;
     void setDefaultStyleFilePath(const io::path_t& path) override;
@@ -98,9 +99,14 @@ public:
     bool guitarProMultivoiceEnabled() const override;
     bool minDistanceForPartialSkylineCalculated() const override;
 
+    size_t undoHistoryMaxSteps() const override;
+    size_t undoHistoryMaxMemory() const override;
+    async::Notification undoHistoryLimitsChanged() const override;
+
 private:
     async::Channel<voice_idx_t, draw::Color> m_voiceColorChanged;
     async::Notification m_scoreInversionChanged;
+    async::Notification m_undoHistoryLimitsChanged;
 
     ValNt<DebuggingOptions> m_debuggingOptions;
 
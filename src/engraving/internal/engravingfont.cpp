@@ -21,9 +21,13 @@
  */
 #include "engravingfont.h"
 
+#include <cstring>
+#include <type_traits>
+
 #include "serialization/json.h"
 #include "io/file.h"
 #include "io/fileinfo.h"
+#include "io/mappedfile.h"
 #include "draw/painter.h"
 #include "types/symnames.h"
 
@@ -38,6 +42,82 @@ using namespace mu::io;
 using namespace mu::draw;
 using namespace mu::engraving;
 
+static constexpr uint32_t METRICS_CACHE_MAGIC = 0x4D46534D; // "MSFM"
+//! NOTE Increment if the layout of the cache file or the way the metrics are computed changes
+static constexpr uint32_t METRICS_CACHE_VERSION = 1;
+
+namespace {
+enum class MetricsCacheValueType : uint8_t {
+    Real,
+    Bool
+};
+
+class MetricsCacheWriter
+{
+public:
+    template<typename T>
+    void write(const T& v)
+    {
+        static_assert(std::is_trivially_copyable<T>::value);
+        m_data.push_back(reinterpret_cast<const uint8_t*>(&v), sizeof(T));
+    }
+
+    const ByteArray& data() const { return m_data; }
+
+private:
+    ByteArray m_data;
+};
+
+class MetricsCacheReader
+{
+public:
+    MetricsCacheReader(const uint8_t* data, size_t size)
+        : m_data(data), m_size(size) {}
+
+    template<typename T>
+    T read()
+    {
+        static_assert(std::is_trivially_copyable<T>::value);
+        T v {};
+        if (m_pos + sizeof(T) > m_size) {
+            m_error = true;
+            return v;
+        }
+
+        std::memcpy(&v, m_data + m_pos, sizeof(T));
+        m_pos += sizeof(T);
+        return v;
+    }
+
+    bool hasError() const { return m_error; }
+    bool atEnd() const { return m_pos == m_size; }
+
+private:
+    const uint8_t* m_data = nullptr;
+    size_t m_size = 0;
+    size_t m_pos = 0;
+    bool m_error = false;
+};
+}
+
+//! NOTE FNV-1a over the font and its metadata, the cache is invalid if either changes
+static uint64_t metricsCacheHash(const ByteArray& fontData, const ByteArray& metadata)
+{
+    uint64_t hash = 14695981039346656037ULL;
+    auto update = [&hash](const ByteArray& data) {
+        const uint8_t* bytes = data.constData();
+        for (size_t i = 0; i < data.size(); ++i) {
+            hash ^= bytes[i];
+            hash *= 1099511628211ULL;
+        }
+    };
+
+    update(fontData);
+    update(metadata);
+
+    return hash;
+}
+
 // =============================================
 // ScoreFont
 // =============================================
@@ -57,6 +137,7 @@ EngravingFont::EngravingFont(const EngravingFont& other)
     m_name     = other.m_name;
     m_family   = other.m_family;
     m_fontPath = other.m_fontPath;
+    m_metricsCachePath = other.m_metricsCachePath;
 }
 
 // =============================================
@@ -104,6 +185,23 @@ void EngravingFont::ensureLoad()
     m_font.setNoFontMerging(true);
     m_font.setHinting(mu::draw::Font::Hinting::PreferVerticalHinting);
 
+    File metadataFile(io::FileInfo(m_fontPath).path() + u"/metadata.json");
+    const bool hasMetadata = metadataFile.open(IODevice::ReadOnly);
+    ByteArray metadata = hasMetadata ? metadataFile.readAll() : ByteArray();
+
+    uint64_t fontHash = 0;
+    if (hasMetadata && !m_metricsCachePath.empty()) {
+        ByteArray fontData;
+        if (File::readFile(m_fontPath, fontData)) {
+            fontHash = metricsCacheHash(fontData, metadata);
+            if (readMetricsCache(fontHash)) {
+                m_loaded = true;
+                m_loadedFromMetricsCache = true;
+                return;
+            }
+        }
+    }
+
     for (size_t id = 0; id < m_symbols.size(); ++id) {
         Smufl::Code code = Smufl::code(static_cast<SymId>(id));
         if (!code.isValid()) {
@@ -113,14 +211,13 @@ void EngravingFont::ensureLoad()
         computeMetrics(sym, code);
     }
 
-    File metadataFile(io::FileInfo(m_fontPath).path() + u"/metadata.json");
-    if (!metadataFile.open(IODevice::ReadOnly)) {
+    if (!hasMetadata) {
         LOGE() << "Failed to open glyph metadata file: " << metadataFile.filePath();
         return;
     }
 
     std::string error;
-    JsonObject metadataJson = JsonDocument::fromJson(metadataFile.readAll(), &error).rootObject();
+    JsonObject metadataJson = JsonDocument::fromJson(metadata, &error).rootObject();
     if (!error.empty()) {
         LOGE() << "Json parse error in " << metadataFile.filePath() << ", error: " << error;
         return;
@@ -131,9 +228,23 @@ void EngravingFont::ensureLoad()
     loadStylisticAlternates(metadataJson.value("glyphsWithAlternates").toObject());
     loadEngravingDefaults(metadataJson.value("engravingDefaults").toObject());
 
+    if (fontHash != 0) {
+        writeMetricsCache(fontHash);
+    }
+
     m_loaded = true;
 }
 
+void EngravingFont::setMetricsCachePath(const io::path_t& path)
+{
+    m_metricsCachePath = path;
+}
+
+bool EngravingFont::isLoadedFromMetricsCache() const
+{
+    return m_loadedFromMetricsCache;
+}
+
 void EngravingFont::loadGlyphsWithAnchors(const JsonObject& glyphsWithAnchors)
 {
     for (const std::string& symName : glyphsWithAnchors.keys()) {
@@ -510,6 +621,153 @@ void EngravingFont::computeMetrics(EngravingFont::Sym& sym, const Smufl::Code& c
     }
 }
 
+// =============================================
+// Metrics cache
+// =============================================
+
+bool EngravingFont::readMetricsCache(uint64_t fontHash)
+{
+    TRACEFUNC;
+
+    if (!File::exists(m_metricsCachePath)) {
+        return false;
+    }
+
+    MappedFile file(m_metricsCachePath);
+    if (!file.open(IODevice::ReadOnly)) {
+        return false;
+    }
+
+    MetricsCacheReader reader(file.readData(), file.size());
+
+    if (reader.read<uint32_t>() != METRICS_CACHE_MAGIC
+        || reader.read<uint32_t>() != METRICS_CACHE_VERSION
+        || reader.read<uint64_t>() != fontHash
+        || reader.read<double>() != DPI_F
+        || reader.read<uint32_t>() != m_symbols.size()) {
+        LOGI() << "Font metrics cache is outdated: " << m_metricsCachePath;
+        return false;
+    }
+
+    std::vector<Sym> symbols(m_symbols.size());
+    for (Sym& sym : symbols) {
+        sym.code = reader.read<char32_t>();
+        double x = reader.read<double>();
+        double y = reader.read<double>();
+        double w = reader.read<double>();
+        double h = reader.read<double>();
+        sym.bbox = RectF(x, y, w, h);
+        sym.advance = reader.read<double>();
+
+        uint8_t anchorCount = reader.read<uint8_t>();
+        for (uint8_t i = 0; i < anchorCount; ++i) {
+            SmuflAnchorId anchorId = static_cast<SmuflAnchorId>(reader.read<uint8_t>());
+            double ax = reader.read<double>();
+            double ay = reader.read<double>();
+            sym.smuflAnchors[anchorId] = PointF(ax, ay);
+        }
+
+        uint8_t subSymbolCount = reader.read<uint8_t>();
+        for (uint8_t i = 0; i < subSymbolCount; ++i) {
+            sym.subSymbolIds.push_back(static_cast<SymId>(reader.read<uint32_t>()));
+        }
+
+        if (reader.hasError()) {
+            break;
+        }
+    }
+
+    double textEnclosureThickness = reader.read<double>();
+
+    std::unordered_map<Sid, PropertyValue> engravingDefaults;
+    uint32_t engravingDefaultsCount = reader.read<uint32_t>();
+    for (uint32_t i = 0; i < engravingDefaultsCount && !reader.hasError(); ++i) {
+        Sid sid = static_cast<Sid>(reader.read<uint32_t>());
+        MetricsCacheValueType type = reader.read<MetricsCacheValueType>();
+        double value = reader.read<double>();
+
+        if (type == MetricsCacheValueType::Bool) {
+            engravingDefaults.insert({ sid, value != 0.0 });
+        } else {
+            engravingDefaults.insert({ sid, value });
+        }
+    }
+
+    if (reader.hasError() || !reader.atEnd()) {
+        LOGE() << "Font metrics cache is corrupted: " << m_metricsCachePath;
+        return false;
+    }
+
+    engravingDefaults.insert({ Sid::MusicalTextFont, String(u"%1 Text").arg(String::fromStdString(m_family)) });
+
+    m_symbols = std::move(symbols);
+    m_engravingDefaults = std::move(engravingDefaults);
+    m_textEnclosureThickness = textEnclosureThickness;
+
+    return true;
+}
+
+void EngravingFont::writeMetricsCache(uint64_t fontHash) const
+{
+    TRACEFUNC;
+
+    MetricsCacheWriter writer;
+    writer.write(METRICS_CACHE_MAGIC);
+    writer.write(METRICS_CACHE_VERSION);
+    writer.write(fontHash);
+    writer.write(DPI_F);
+    writer.write(static_cast<uint32_t>(m_symbols.size()));
+
+    for (const Sym& sym : m_symbols) {
+        writer.write(sym.code);
+        writer.write(sym.bbox.x());
+        writer.write(sym.bbox.y());
+        writer.write(sym.bbox.width());
+        writer.write(sym.bbox.height());
+        writer.write(sym.advance);
+
+        writer.write(static_cast<uint8_t>(sym.smuflAnchors.size()));
+        for (const auto& pair : sym.smuflAnchors) {
+            writer.write(static_cast<uint8_t>(pair.first));
+            writer.write(pair.second.x());
+            writer.write(pair.second.y());
+        }
+
+        writer.write(static_cast<uint8_t>(sym.subSymbolIds.size()));
+        for (SymId id : sym.subSymbolIds) {
+            writer.write(static_cast<uint32_t>(id));
+        }
+    }
+
+    writer.write(m_textEnclosureThickness);
+
+    //! NOTE MusicalTextFont is derived from the family, it is not stored
+    std::vector<std::pair<Sid, PropertyValue> > engravingDefaults;
+    for (const auto& pair : m_engravingDefaults) {
+        if (pair.second.type() == P_TYPE::REAL || pair.second.type() == P_TYPE::BOOL) {
+            engravingDefaults.push_back(pair);
+        }
+    }
+
+    writer.write(static_cast<uint32_t>(engravingDefaults.size()));
+    for (const auto& pair : engravingDefaults) {
+        writer.write(static_cast<uint32_t>(pair.first));
+        if (pair.second.type() == P_TYPE::BOOL) {
+            writer.write(MetricsCacheValueType::Bool);
+            writer.write(pair.second.value<bool>() ? 1.0 : 0.0);
+        } else {
+            writer.write(MetricsCacheValueType::Real);
+            writer.write(pair.second.value<double>());
+        }
+    }
+
+    //! NOTE Other processes may have the cache mapped or be reading it, so it is replaced, not rewritten
+    Ret ret = MappedFile::writeFile(m_metricsCachePath, writer.data());
+    if (!ret) {
+        LOGW() << "Failed to write font metrics cache: " << m_metricsCachePath << ", error: " << ret.toString();
+    }
+}
+
 // =============================================
 // Symbol properties
 // =============================================
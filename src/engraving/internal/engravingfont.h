@@ -92,6 +92,11 @@ public:
 
     void ensureLoad();
 
+    //! NOTE If set, the symbol metrics are stored to this file after the first load
+    //! and read from it on the next loads, as long as the font files have not changed
+    void setMetricsCachePath(const io::path_t& path);
+    bool isLoadedFromMetricsCache() const;
+
 private:
 
     friend class SymbolFonts;
@@ -121,18 +126,23 @@ private:
     void loadEngravingDefaults(const JsonObject& engravingDefaultsObject);
     void computeMetrics(Sym& sym, const Smufl::Code& code);
 
+    bool readMetricsCache(uint64_t fontHash);
+    void writeMetricsCache(uint64_t fontHash) const;
+
     Sym& sym(SymId id);
     const Sym& sym(SymId id) const;
 
     bool useFallbackFont(SymId id) const;
 
     bool m_loaded = false;
+    bool m_loadedFromMetricsCache = false;
     std::vector<Sym> m_symbols;
     mutable draw::Font m_font;
 
     std::string m_name;
     std::string m_family;
     io::path_t m_fontPath;
+    io::path_t m_metricsCachePath;
 
     std::unordered_map<Sid, PropertyValue> m_engravingDefaults;
     double m_textEnclosureThickness = 0;
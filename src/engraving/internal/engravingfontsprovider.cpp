@@ -32,6 +32,7 @@ using namespace mu::engraving;
 void EngravingFontsProvider::addFont(const std::string& name, const std::string& family, const io::path_t& filePath)
 {
     std::shared_ptr<EngravingFont> f = std::make_shared<EngravingFont>(name, family, filePath);
+    f->setMetricsCachePath(metricsCachePath(f.get()));
     m_symbolFonts.push_back(f);
     m_fallback.font = nullptr;
 }
@@ -103,3 +104,25 @@ void EngravingFontsProvider::loadAllFonts()
         f->ensureLoad();
     }
 }
+
+void EngravingFontsProvider::setMetricsCacheDirPath(const io::path_t& dirPath)
+{
+    m_metricsCacheDirPath = dirPath;
+
+    if (!m_metricsCacheDirPath.empty() && fileSystem()) {
+        fileSystem()->makePath(m_metricsCacheDirPath);
+    }
+
+    for (std::shared_ptr<EngravingFont>& f : m_symbolFonts) {
+        f->setMetricsCachePath(metricsCachePath(f.get()));
+    }
+}
+
+io::path_t EngravingFontsProvider::metricsCachePath(const EngravingFont* font) const
+{
+    if (m_metricsCacheDirPath.empty()) {
+        return io::path_t();
+    }
+
+    return m_metricsCacheDirPath + "/" + io::escapeFileName(font->name()) + ".metrics";
+}
@@ -26,6 +26,8 @@
 #include <vector>
 
 #include "iengravingfontsprovider.h"
+#include "modularity/ioc.h"
+#include "io/ifilesystem.h"
 
 #include "engravingfont.h"
 
@@ -33,6 +35,8 @@ namespace mu::engraving {
 class EngravingFont;
 class EngravingFontsProvider : public IEngravingFontsProvider
 {
+    INJECT(io::IFileSystem, fileSystem)
+
 public:
 
     void addFont(const std::string& name, const std::string& family, const io::path_t& filePath) override;
@@ -45,10 +49,13 @@ public:
 
     void loadAllFonts() override;
 
+    void setMetricsCacheDirPath(const io::path_t& dirPath) override;
+
 private:
 
     std::shared_ptr<EngravingFont> doFontByName(const std::string& name) const;
     std::shared_ptr<EngravingFont> doFallbackFont() const;
+    io::path_t metricsCachePath(const EngravingFont* font) const;
 
     struct Fallback {
         std::string name;
@@ -57,6 +64,7 @@ private:
 
     mutable Fallback m_fallback;
     std::vector<std::shared_ptr<EngravingFont> > m_symbolFonts;
+    io::path_t m_metricsCacheDirPath;
 };
 }
 
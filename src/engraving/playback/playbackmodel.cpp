@@ -22,6 +22,12 @@
 
 #include "playbackmodel.h"
 
+#include <algorithm>
+#include <chrono>
+#include <limits>
+
+#include "async/async.h"
+
 #include "dom/fret.h"
 #include "dom/instrument.h"
 #include "dom/masterscore.h"
@@ -43,6 +49,14 @@ using namespace mu::async;
 static const std::string METRONOME_INSTRUMENT_ID("metronome");
 static const std::string CHORD_SYMBOLS_INSTRUMENT_ID("chord_symbols");
 
+static constexpr timestamp_t MIN_TIMESTAMP = std::numeric_limits<timestamp_t>::min();
+static constexpr timestamp_t MAX_TIMESTAMP = std::numeric_limits<timestamp_t>::max();
+
+static double elapsedMs(const std::chrono::steady_clock::time_point& start)
+{
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
 const InstrumentTrackId PlaybackModel::METRONOME_TRACK_ID = { 999, METRONOME_INSTRUMENT_ID };
 
 static const Harmony* findChordSymbol(const EngravingItem* item)
@@ -75,6 +89,8 @@ void PlaybackModel::load(Score* score)
         TickBoundaries tickRange = tickBoundaries(range);
         TrackBoundaries trackRange = trackBoundaries(range);
 
+        m_changedRanges.clear();
+
         clearExpiredTracks();
         clearExpiredContexts(trackRange.trackFrom, trackRange.trackTo);
         clearExpiredEvents(tickRange.tickFrom, tickRange.tickTo, trackRange.trackFrom, trackRange.trackTo);
@@ -85,9 +101,11 @@ void PlaybackModel::load(Score* score)
         update(tickRange.tickFrom, tickRange.tickTo, trackRange.trackFrom, trackRange.trackTo, &trackChanges);
 
         notifyAboutChanges(oldTracks, trackChanges);
+
+        m_changedRanges.clear();
     });
 
-    update(0, m_score->lastMeasure()->endTick().ticks(), 0, m_score->ntracks());
+    updateInitialEvents();
 
     for (const auto& pair : m_playbackDataMap) {
         m_trackAdded.send(pair.first);
@@ -101,11 +119,6 @@ void PlaybackModel::reload()
     int trackFrom = 0;
     size_t trackTo = m_score->ntracks();
 
-    const Measure* lastMeasure = m_score->lastMeasure();
-
-    int tickFrom = 0;
-    int tickTo = lastMeasure ? lastMeasure->endTick().ticks() : 0;
-
     clearExpiredTracks();
     clearExpiredContexts(trackFrom, trackTo);
 
@@ -113,7 +126,11 @@ void PlaybackModel::reload()
         pair.second.originEvents.clear();
     }
 
-    update(tickFrom, tickTo, trackFrom, trackTo);
+    if (m_score->lastMeasure()) {
+        updateInitialEvents();
+    } else {
+        update(0, 0, trackFrom, trackTo);
+    }
 
     for (auto& pair : m_playbackDataMap) {
         pair.second.mainStream.send(pair.second.originEvents);
@@ -147,6 +164,17 @@ void PlaybackModel::setPlayChordSymbols(const bool isEnabled)
     m_playChordSymbols = isEnabled;
 }
 
+bool PlaybackModel::isDeferredRenderingEnabled() const
+{
+    return m_deferredRendering;
+}
+
+void PlaybackModel::setDeferredRendering(const bool isEnabled, const int chunkMeasures)
+{
+    m_deferredRendering = isEnabled;
+    m_deferredChunkMeasures = std::max(chunkMeasures, 1);
+}
+
 const InstrumentTrackId& PlaybackModel::metronomeTrackId() const
 {
     return METRONOME_TRACK_ID;
@@ -276,6 +304,83 @@ void PlaybackModel::update(const int tickFrom, const int tickTo, const track_idx
     updateEvents(tickFrom, tickTo, trackFrom, trackTo, trackChanges);
 }
 
+void PlaybackModel::updateInitialEvents()
+{
+    TRACEFUNC;
+
+    m_renderStartTime = std::chrono::steady_clock::now();
+    const uint64_t generation = ++m_renderGeneration;
+
+    const int lastTick = m_score->lastMeasure()->endTick().ticks();
+    const int chunkEndTick = m_deferredRendering ? deferredChunkEndTick(0) : lastTick;
+
+    if (chunkEndTick >= lastTick) {
+        update(0, lastTick, 0, m_score->ntracks());
+        LOGI() << "playback events rendered in " << elapsedMs(m_renderStartTime) << " ms";
+        return;
+    }
+
+    //! NOTE tickTo is inclusive, segments starting at the chunk end belong to the next chunk
+    update(0, chunkEndTick - 1, 0, m_score->ntracks());
+    LOGI() << "time to first sound: " << elapsedMs(m_renderStartTime) << " ms (ticks 0-" << chunkEndTick << ")";
+
+    Async::call(this, [this, chunkEndTick, generation]() {
+        renderDeferredChunk(chunkEndTick, generation);
+    });
+}
+
+void PlaybackModel::renderDeferredChunk(const int tickFrom, const uint64_t generation)
+{
+    if (generation != m_renderGeneration || !m_score || !m_score->lastMeasure()) {
+        return;
+    }
+
+    TRACEFUNC;
+
+    const int lastTick = m_score->lastMeasure()->endTick().ticks();
+    const int chunkEndTick = deferredChunkEndTick(tickFrom);
+    const bool isLastChunk = chunkEndTick >= lastTick;
+    const int tickTo = isLastChunk ? lastTick : chunkEndTick - 1;
+    const track_idx_t trackTo = m_score->ntracks();
+
+    m_changedRanges.clear();
+
+    //! NOTE The range might have been rendered already by a change of the score in the meantime
+    clearExpiredEvents(tickFrom, tickTo, 0, trackTo);
+
+    InstrumentTrackIdSet oldTracks = existingTrackIdSet();
+
+    ChangedTrackIdSet trackChanges;
+    updateEvents(tickFrom, tickTo, 0, trackTo, &trackChanges);
+
+    notifyAboutChanges(oldTracks, trackChanges);
+
+    m_changedRanges.clear();
+
+    if (isLastChunk) {
+        LOGI() << "playback events rendered in " << elapsedMs(m_renderStartTime) << " ms (deferred)";
+        return;
+    }
+
+    Async::call(this, [this, chunkEndTick, generation]() {
+        renderDeferredChunk(chunkEndTick, generation);
+    });
+}
+
+int PlaybackModel::deferredChunkEndTick(const int tickFrom) const
+{
+    const Measure* measure = m_score->tick2measure(Fraction::fromTicks(tickFrom));
+    if (!measure) {
+        return std::numeric_limits<int>::max();
+    }
+
+    for (int i = 1; i < m_deferredChunkMeasures && measure->nextMeasure(); ++i) {
+        measure = measure->nextMeasure();
+    }
+
+    return measure->endTick().ticks();
+}
+
 void PlaybackModel::updateSetupData()
 {
     for (const Part* part : m_score->parts()) {
@@ -353,8 +458,9 @@ void PlaybackModel::processSegment(const int tickPositionOffset, const Segment*
         }
 
         if (chordSymbol->play()) {
-            m_renderer.renderChordSymbol(chordSymbol, tickPositionOffset, profile,
-                                         m_playbackDataMap[trackId].originEvents);
+            renderTrackEvents(trackId, [&](PlaybackEventsMap& result) {
+                m_renderer.renderChordSymbol(chordSymbol, tickPositionOffset, profile, result);
+            });
         }
 
         collectChangesTracks(trackId, trackChanges);
@@ -404,9 +510,11 @@ void PlaybackModel::processSegment(const int tickPositionOffset, const Segment*
             continue;
         }
 
-        m_renderer.render(item, tickPositionOffset, ctx.appliableDynamicLevel(segmentStartTick + tickPositionOffset),
-                          ctx.persistentArticulationType(segmentStartTick + tickPositionOffset), std::move(profile),
-                          m_playbackDataMap[trackId].originEvents);
+        renderTrackEvents(trackId, [&](PlaybackEventsMap& result) {
+            m_renderer.render(item, tickPositionOffset, ctx.appliableDynamicLevel(segmentStartTick + tickPositionOffset),
+                              ctx.persistentArticulationType(segmentStartTick + tickPositionOffset), std::move(profile),
+                              result);
+        });
 
         collectChangesTracks(trackId, trackChanges);
     }
@@ -488,8 +596,9 @@ void PlaybackModel::updateEvents(const int tickFrom, const int tickTo, const tra
                 isFirstSegmentOfMeasure = false;
             }
 
-            m_renderer.renderMetronome(m_score, measureStartTick, measureEndTick, tickPositionOffset,
-                                       m_playbackDataMap[METRONOME_TRACK_ID].originEvents);
+            renderTrackEvents(METRONOME_TRACK_ID, [&](PlaybackEventsMap& result) {
+                m_renderer.renderMetronome(m_score, measureStartTick, measureEndTick, tickPositionOffset, result);
+            });
             collectChangesTracks(METRONOME_TRACK_ID, trackChanges);
         }
     }
@@ -688,7 +797,7 @@ void PlaybackModel::notifyAboutChanges(const InstrumentTrackIdSet& oldTracks, co
             continue;
         }
 
-        search->second.mainStream.send(search->second.originEvents);
+        sendTrackEvents(search->second, trackId);
         search->second.dynamicLevelChanges.send(search->second.dynamicLevelMap);
     }
 
@@ -716,6 +825,7 @@ void PlaybackModel::removeTrackEvents(const InstrumentTrackId& trackId, const mp
 
     if (timestampFrom == -1 && timestampTo == -1) {
         search->second.originEvents.clear();
+        m_changedRanges[trackId].push_back({ MIN_TIMESTAMP, MAX_TIMESTAMP });
         return;
     }
 
@@ -725,8 +835,10 @@ void PlaybackModel::removeTrackEvents(const InstrumentTrackId& trackId, const mp
         //!Note Some events might be started RIGHT before the "official" start of the track
         //!     Need to make sure that we don't miss those events
         lowerBound = trackPlaybackData.originEvents.begin();
+        m_changedRanges[trackId].push_back({ MIN_TIMESTAMP, timestampTo });
     } else {
         lowerBound = trackPlaybackData.originEvents.lower_bound(timestampFrom);
+        m_changedRanges[trackId].push_back({ timestampFrom, timestampTo });
     }
 
     auto upperBound = trackPlaybackData.originEvents.upper_bound(timestampTo);
@@ -736,6 +848,75 @@ void PlaybackModel::removeTrackEvents(const InstrumentTrackId& trackId, const mp
     }
 }
 
+template<typename RenderFunc>
+void PlaybackModel::renderTrackEvents(const InstrumentTrackId& trackId, RenderFunc render)
+{
+    PlaybackEventsMap& originEvents = m_playbackDataMap[trackId].originEvents;
+
+    auto rangesSearch = m_changedRanges.find(trackId);
+    if (rangesSearch == m_changedRanges.end()) {
+        render(originEvents);
+        return;
+    }
+
+    //! NOTE The track is being partially updated, so we need to know which timestamps the rendered events touch.
+    //!      Usually they are inside of the removed range, but e.g. the events of a segment which starts
+    //!      before the changed range might extend it
+    PlaybackEventsMap renderedEvents;
+    render(renderedEvents);
+
+    if (renderedEvents.empty()) {
+        return;
+    }
+
+    TimestampRange renderedRange { renderedEvents.begin()->first, renderedEvents.rbegin()->first };
+    TimestampRangeList& ranges = rangesSearch->second;
+
+    bool isCovered = std::any_of(ranges.cbegin(), ranges.cend(), [&renderedRange](const TimestampRange& range) {
+        return range.from <= renderedRange.from && renderedRange.to <= range.to;
+    });
+
+    if (!isCovered) {
+        ranges.push_back(renderedRange);
+    }
+
+    for (auto it = renderedEvents.begin(); it != renderedEvents.end();) {
+        auto next = std::next(it);
+        auto target = originEvents.find(it->first);
+
+        if (target == originEvents.end()) {
+            originEvents.insert(renderedEvents.extract(it));
+        } else {
+            PlaybackEventList& targetEvents = target->second;
+            targetEvents.insert(targetEvents.end(), std::make_move_iterator(it->second.begin()),
+                                std::make_move_iterator(it->second.end()));
+        }
+
+        it = next;
+    }
+}
+
+void PlaybackModel::sendTrackEvents(PlaybackData& trackPlaybackData, const InstrumentTrackId& trackId)
+{
+    auto rangesSearch = m_changedRanges.find(trackId);
+    if (rangesSearch == m_changedRanges.end() || rangesSearch->second.empty()) {
+        trackPlaybackData.mainStream.send(trackPlaybackData.originEvents);
+        return;
+    }
+
+    PlaybackEventsDelta delta;
+    delta.ranges = normalizedRanges(rangesSearch->second);
+
+    bool isWholeTrack = delta.ranges.front().from == MIN_TIMESTAMP && delta.ranges.front().to == MAX_TIMESTAMP;
+    if (isWholeTrack) {
+        trackPlaybackData.mainStream.send(trackPlaybackData.originEvents);
+        return;
+    }
+
+    delta.events = playbackEventsInRanges(trackPlaybackData.originEvents, delta.ranges);
+    trackPlaybackData.mainStreamDelta.send(delta);
+}
+
 PlaybackModel::TrackBoundaries PlaybackModel::trackBoundaries(const ScoreChangesRange& changesRange) const
 {
     TrackBoundaries result;
@@ -23,6 +23,7 @@
 #ifndef MU_ENGRAVING_PLAYBACKMODEL_H
 #define MU_ENGRAVING_PLAYBACKMODEL_H
 
+#include <chrono>
 #include <unordered_map>
 #include <map>
 #include <functional>
@@ -64,6 +65,14 @@ public:
     bool isPlayChordSymbolsEnabled() const;
     void setPlayChordSymbols(const bool isEnabled);
 
+    static constexpr int DEFAULT_DEFERRED_CHUNK_MEASURES = 16;
+
+    //! NOTE If enabled, load/reload render only the first measures at once,
+    //!      the rest of the score is rendered in chunks on the next event loop iterations
+    //!      and sent to the tracks as partial updates
+    bool isDeferredRenderingEnabled() const;
+    void setDeferredRendering(const bool isEnabled, const int chunkMeasures = DEFAULT_DEFERRED_CHUNK_MEASURES);
+
     const InstrumentTrackId& metronomeTrackId() const;
     InstrumentTrackId chordSymbolsTrackId(const ID& partId) const;
     bool isChordSymbolsTrack(const InstrumentTrackId& trackId) const;
@@ -102,6 +111,9 @@ private:
 
     void update(const int tickFrom, const int tickTo, const track_idx_t trackFrom, const track_idx_t trackTo,
                 ChangedTrackIdSet* trackChanges = nullptr);
+    void updateInitialEvents();
+    void renderDeferredChunk(const int tickFrom, const uint64_t generation);
+    int deferredChunkEndTick(const int tickFrom) const;
     void updateSetupData();
     void updateContext(const track_idx_t trackFrom, const track_idx_t trackTo);
     void updateContext(const InstrumentTrackId& trackId);
@@ -128,6 +140,10 @@ private:
     void removeTrackEvents(const InstrumentTrackId& trackId, const mpe::timestamp_t timestampFrom = -1,
                            const mpe::timestamp_t timestampTo = -1);
 
+    template<typename RenderFunc>
+    void renderTrackEvents(const InstrumentTrackId& trackId, RenderFunc render);
+    void sendTrackEvents(mpe::PlaybackData& trackPlaybackData, const InstrumentTrackId& trackId);
+
     TrackBoundaries trackBoundaries(const ScoreChangesRange& changesRange) const;
     TickBoundaries tickBoundaries(const ScoreChangesRange& changesRange) const;
 
@@ -140,6 +156,12 @@ private:
     Score* m_score = nullptr;
     bool m_expandRepeats = true;
     bool m_playChordSymbols = true;
+    bool m_deferredRendering = false;
+    int m_deferredChunkMeasures = DEFAULT_DEFERRED_CHUNK_MEASURES;
+
+    //! NOTE Incremented on every load/reload, so deferred chunks of the previous one are dropped
+    uint64_t m_renderGeneration = 0;
+    std::chrono::steady_clock::time_point m_renderStartTime;
 
     PlaybackEventsRenderer m_renderer;
     PlaybackSetupDataResolver m_setupResolver;
@@ -147,6 +169,10 @@ private:
     std::unordered_map<InstrumentTrackId, PlaybackContext> m_playbackCtxMap;
     std::unordered_map<InstrumentTrackId, mpe::PlaybackData> m_playbackDataMap;
 
+    //! NOTE Timestamp ranges of the origin events which were replaced during the current change,
+    //!      used to send the partial updates (see mpe::PlaybackEventsDelta) instead of the whole events map
+    std::unordered_map<InstrumentTrackId, mpe::TimestampRangeList> m_changedRanges;
+
     async::Notification m_dataChanged;
     async::Channel<InstrumentTrackId> m_trackAdded;
     async::Channel<InstrumentTrackId> m_trackRemoved;
@@ -134,7 +134,7 @@ void Autoplace::autoplaceMeasureElement(const EngravingItem* item, EngravingItem
 
         SysStaff* ss = m->system()->staff(si);
         // shape rather than bbox is good for tuplets especially
-        Shape sh = item->shape().translate(m->pos() + item->pos());
+        Shape sh = item->shape().translated(m->pos() + item->pos());
 
         SkylineLine sk(!above);
         double d;
@@ -369,7 +369,7 @@ void Autoplace::doAutoplace(const Articulation* item, Articulation::LayoutData*
 
         SysStaff* ss = m->system()->staff(si);
 
-        Shape thisShape = item->shape().translate(item->chordRest()->pos() + m->pos() + s->pos() + item->pos());
+        Shape thisShape = item->shape().translated(item->chordRest()->pos() + m->pos() + s->pos() + item->pos());
 
         for (const ShapeElement& shapeEl : thisShape.elements()) {
             RectF r = shapeEl;
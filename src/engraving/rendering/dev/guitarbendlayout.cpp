@@ -323,7 +323,7 @@ void GuitarBendLayout::adjustX(GuitarBendSegment* item, PointF& startPos, PointF
     const double padding = 0.2 * item->spatium();
 
     if (item->isSingleBeginType()) {
-        Shape startChordShape = startChord->shape().translate(
+        Shape startChordShape = startChord->shape().translated(
             startChord->pos() + startChord->segment()->pos() + startChord->measure()->pos());
         double pointToClear = startChordShape.rightMostEdgeAtHeight(startPos.y() + vertMargin, startPos.y() - vertMargin);
         pointToClear += padding;
@@ -332,7 +332,7 @@ void GuitarBendLayout::adjustX(GuitarBendSegment* item, PointF& startPos, PointF
     }
 
     if (item->isSingleEndType()) {
-        Shape endChordShape = endChord->shape().translate(
+        Shape endChordShape = endChord->shape().translated(
             endChord->pos() + endChord->segment()->pos() + endChord->measure()->pos());
         double pointToClear = endChordShape.leftMostEdgeAtHeight(endPos.y() + vertMargin, endPos.y() - vertMargin);
         pointToClear -= padding;
@@ -38,7 +38,10 @@ using namespace mu::engraving::rendering::dev;
 
 LayoutConfiguration::LayoutConfiguration(IGetScoreInternal* s)
     : m_getScore(s)
-{}
+{
+    const Score* score = m_getScore->score();
+    m_style = score ? &score->style() : &DefaultStyle::defaultStyle();
+}
 
 const Score* LayoutConfiguration::score() const
 {
@@ -82,10 +85,8 @@ std::shared_ptr<const IEngravingFont> LayoutConfiguration::engravingFont() const
 
 const MStyle& LayoutConfiguration::style() const
 {
-    IF_ASSERT_FAILED(score()) {
-        return DefaultStyle::defaultStyle();
-    }
-    return score()->style();
+    ++m_styleLookups.values;
+    return *m_style;
 }
 
 bool LayoutConfiguration::isShowInvisible() const
@@ -112,9 +113,9 @@ bool LayoutConfiguration::isVerticalSpreadEnabled() const
 double LayoutConfiguration::maxSystemDistance() const
 {
     if (isVerticalSpreadEnabled()) {
-        return style().styleMM(Sid::maxSystemSpread);
+        return styleMM(Sid::maxSystemSpread);
     } else {
-        return style().styleMM(Sid::maxSystemDistance);
+        return styleMM(Sid::maxSystemDistance);
     }
 }
 
@@ -94,13 +94,43 @@ public:
 
     const MStyle& style() const;
 
-    const PropertyValue& styleV(Sid idx) const { return style().styleV(idx); }
-    Spatium styleS(Sid idx) const { return style().styleS(idx); }
-    Millimetre styleMM(Sid idx) const { return style().styleMM(idx); }
-    String styleSt(Sid idx) const { return style().styleSt(idx); }
-    bool styleB(Sid idx) const { return style().styleB(idx); }
-    double styleD(Sid idx) const { return style().styleD(idx); }
-    int styleI(Sid idx) const { return style().styleI(idx); }
+    //! NOTE Typed values are read from the resolved values of the style,
+    //! only styleV and styleSt go through PropertyValue
+    const PropertyValue& styleV(Sid idx) const { ++m_styleLookups.values; return style().styleV(idx); }
+    String styleSt(Sid idx) const { ++m_styleLookups.values; return style().styleSt(idx); }
+
+    Spatium styleS(Sid idx) const
+    {
+        assert(MStyle::valueType(idx) == P_TYPE::SPATIUM);
+        return Spatium(resolved(idx).real);
+    }
+
+    Millimetre styleMM(Sid idx) const
+    {
+        assert(MStyle::valueType(idx) == P_TYPE::SPATIUM);
+        return Millimetre(resolved(idx).mm);
+    }
+
+    bool styleB(Sid idx) const
+    {
+        assert(MStyle::valueType(idx) == P_TYPE::BOOL);
+        return resolved(idx).integer != 0;
+    }
+
+    double styleD(Sid idx) const
+    {
+        assert(MStyle::valueType(idx) == P_TYPE::REAL);
+        return resolved(idx).real;
+    }
+
+    int styleI(Sid idx) const { return resolved(idx).integer; }
+
+    struct StyleLookups {
+        size_t resolved = 0;    // served by typed resolved values
+        size_t values = 0;      // went through PropertyValue
+    };
+
+    const StyleLookups& styleLookups() const { return m_styleLookups; }
 
     double spatium() const { return styleD(Sid::spatium); }
     double point(const Spatium sp) const { return sp.val() * spatium(); }
@@ -123,7 +153,15 @@ private:
     const Score* score() const;
     const LayoutOptions& options() const;
 
+    const MStyle::ResolvedValue& resolved(Sid idx) const
+    {
+        ++m_styleLookups.resolved;
+        return m_style->resolvedValue(idx);
+    }
+
     IGetScoreInternal* m_getScore = nullptr;
+    const MStyle* m_style = nullptr;
+    mutable StyleLookups m_styleLookups;
 };
 
 class DomAccessor
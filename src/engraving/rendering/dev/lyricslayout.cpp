@@ -450,7 +450,7 @@ void LyricsLayout::layout(LyricsLineSegment* item, LayoutContext& ctx)
     double lw = item->lyricsLine()->lineWidth() * .5;
     item->setbbox(r.adjusted(-lw, -lw, lw, lw));
     if (item->system() && lyr->addToSkyline()) {
-        item->system()->staff(lyr->staffIdx())->skyline().add(item->shape().translate(item->pos()));
+        item->system()->staff(lyr->staffIdx())->skyline().add(item->shape(), item->pos());
     }
 }
 
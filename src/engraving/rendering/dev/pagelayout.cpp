@@ -389,7 +389,7 @@ void PageLayout::collectPage(LayoutContext& ctx)
         }
     }
 
-    ctx.mutState().page()->invalidateBspTree();
+    ctx.mutState().page()->invalidateSpatialIndex();
 }
 
 //---------------------------------------------------------
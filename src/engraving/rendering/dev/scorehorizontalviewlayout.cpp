@@ -233,7 +233,7 @@ void ScoreHorizontalViewLayout::layoutLinear(LayoutContext& ctx)
     system->setPos(lm, tm);
     ctx.mutState().page()->setWidth(lm + system->width() + rm);
     ctx.mutState().page()->setHeight(tm + system->height() + bm);
-    ctx.mutState().page()->invalidateBspTree();
+    ctx.mutState().page()->invalidateSpatialIndex();
 }
 
 // Append all measures to System. VBox is not included to System
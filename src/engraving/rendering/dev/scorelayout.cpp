@@ -90,4 +90,9 @@ void ScoreLayout::layoutRange(Score* score, const Fraction& st, const Fraction&
         ScoreVerticalViewLayout::layoutVerticalView(score, ctx, stick, etick);
         break;
     }
+
+    if (isLayoutAll) {
+        const LayoutConfiguration::StyleLookups& lookups = ctx.conf().styleLookups();
+        LOGD() << "style lookups: " << lookups.resolved << " resolved, " << lookups.values << " through PropertyValue";
+    }
 }
@@ -1367,7 +1367,7 @@ void SlurTieLayout::adjustX(TieSegment* tieSegment, SlurTiePos& sPos, Grip start
         double yDiff = system->staff(chord->vStaffIdx())->y() - system->staff(tie->staffIdx())->y();
         chordSystemPos += PointF(0.0, yDiff);
     }
-    Shape chordShape = chord->shape().translate(chordSystemPos);
+    Shape chordShape = chord->shape().translated(chordSystemPos);
     chordShape.remove_if([note](ShapeElement& s) {
         return !s.item() || (s.item() == note || s.item()->isHook() || s.item()->isLedgerLine());
     });
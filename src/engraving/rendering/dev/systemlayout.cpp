@@ -797,7 +797,7 @@ void SystemLayout::layoutSystemElements(System* system, LayoutContext& ctx)
                 } else if (s.segmentType() & SegmentType::TimeSig) {
                     TimeSig* ts = toTimeSig(s.element(staffIdx * VOICES));
                     if (ts && ts->addToSkyline()) {
-                        skyline.add(ts->shape().translate(ts->pos() + p));
+                        skyline.add(ts->shape(), ts->pos() + p);
                     }
                 } else {
                     track_idx_t strack = staffIdx * VOICES;
@@ -813,7 +813,7 @@ void SystemLayout::layoutSystemElements(System* system, LayoutContext& ctx)
 
                         // add element to skyline
                         if (e->addToSkyline()) {
-                            skyline.add(e->shape().translated(e->pos() + p));
+                            skyline.add(e->shape(), e->pos() + p);
                             // add grace notes to skyline
                             if (e->isChord()) {
                                 GraceNotesGroup& graceBefore = toChord(e)->graceNotesBefore();
@@ -821,10 +821,10 @@ void SystemLayout::layoutSystemElements(System* system, LayoutContext& ctx)
                                 TLayout::layoutGraceNotesGroup2(&graceBefore, graceBefore.mutldata());
                                 TLayout::layoutGraceNotesGroup2(&graceAfter, graceAfter.mutldata());
                                 if (!graceBefore.empty()) {
-                                    skyline.add(graceBefore.shape().translated(graceBefore.pos() + p));
+                                    skyline.add(graceBefore.shape(), graceBefore.pos() + p);
                                 }
                                 if (!graceAfter.empty()) {
-                                    skyline.add(graceAfter.shape().translated(graceAfter.pos() + p));
+                                    skyline.add(graceAfter.shape(), graceAfter.pos() + p);
                                 }
                             }
                             // If present, add ornament cue note to skyline
@@ -833,7 +833,7 @@ void SystemLayout::layoutSystemElements(System* system, LayoutContext& ctx)
                                 if (ornament) {
                                     Chord* cue = ornament->cueNoteChord();
                                     if (cue && cue->upNote()->visible()) {
-                                        skyline.add(cue->shape().translate(cue->pos() + p));
+                                        skyline.add(cue->shape(), cue->pos() + p);
                                     }
                                 }
                             }
@@ -846,7 +846,7 @@ void SystemLayout::layoutSystemElements(System* system, LayoutContext& ctx)
                             Chord* c2 = t->chord2();
                             if (!t->twoNotes() || (c1 && !c1->staffMove() && c2 && !c2->staffMove())) {
                                 if (t->chord() == e && t->addToSkyline()) {
-                                    skyline.add(t->shape().translate(t->pos() + e->pos() + p));
+                                    skyline.add(t->shape(), t->pos() + e->pos() + p);
                                 }
                             }
                         }
@@ -1009,7 +1009,7 @@ void SystemLayout::layoutSystemElements(System* system, LayoutContext& ctx)
         staff_idx_t si = e->staffIdx();
         Segment* s = toSegment(parent);
         Measure* m = s->measure();
-        system->staff(si)->skyline().add(e->shape().translate(e->pos() + s->pos() + m->pos()));
+        system->staff(si)->skyline().add(e->shape(), e->pos() + s->pos() + m->pos());
     }
 
     //-------------------------------------------------------------
@@ -1023,7 +1023,7 @@ void SystemLayout::layoutSystemElements(System* system, LayoutContext& ctx)
             if (e->isExpression()) {
                 TLayout::layoutItem(e, ctx);
                 if (e->addToSkyline()) {
-                    system->staff(e->staffIdx())->skyline().add(e->shape().translate(e->pos() + s->pos() + m->pos()));
+                    system->staff(e->staffIdx())->skyline().add(e->shape(), e->pos() + s->pos() + m->pos());
                 }
             }
         }
@@ -1199,7 +1199,7 @@ void SystemLayout::layoutSystemElements(System* system, LayoutContext& ctx)
                     ss->mutldata()->setPosY(y);
                 }
                 if (ss->addToSkyline()) {
-                    system->staff(staffIdx)->skyline().add(ss->shape().translate(ss->pos()));
+                    system->staff(staffIdx)->skyline().add(ss->shape(), ss->pos());
                 }
             }
 
@@ -1486,7 +1486,7 @@ void SystemLayout::processLines(System* system, LayoutContext& ctx, std::vector<
             if (stfIdx == mu::nidx) {
                 continue;
             }
-            system->staff(stfIdx)->skyline().add(ss->shape().translate(ss->pos()));
+            system->staff(stfIdx)->skyline().add(ss->shape(), ss->pos());
         }
     }
 }
@@ -1504,7 +1504,7 @@ void SystemLayout::layoutTies(Chord* ch, System* system, const Fraction& stick)
         if (t) {
             TieSegment* ts = SlurTieLayout::tieLayoutFor(t, system);
             if (ts && ts->addToSkyline()) {
-                staff->skyline().add(ts->shape().translate(ts->pos()));
+                staff->skyline().add(ts->shape(), ts->pos());
                 stackedForwardTies.push_back(ts);
             }
         }
@@ -1513,7 +1513,7 @@ void SystemLayout::layoutTies(Chord* ch, System* system, const Fraction& stick)
             if (t->startNote()->tick() < stick) {
                 TieSegment* ts = SlurTieLayout::tieLayoutBack(t, system);
                 if (ts && ts->addToSkyline()) {
-                    staff->skyline().add(ts->shape().translate(ts->pos()));
+                    staff->skyline().add(ts->shape(), ts->pos());
                     stackedBackwardTies.push_back(ts);
                 }
             }
@@ -1013,7 +1013,7 @@ void ChordLayout::layoutArticulations2(Chord* item, LayoutContext& ctx, bool lay
             // but adding to skyline is always good
             Segment* s = item->segment();
             Measure* m = s->measure();
-            Shape sh = a->shape().translate(a->pos() + item->pos());
+            Shape sh = a->shape().translated(a->pos() + item->pos());
             // TODO: limit to width of chord
             // this avoids "staircase" effect due to space not having been allocated already
             // ANOTHER alternative is to allocate the space in layoutPitched() / layoutTablature()
@@ -1053,8 +1053,8 @@ void ChordLayout::layoutArticulations3(Chord* item, Slur* slur, LayoutContext& c
         if (a->layoutCloseToNote() || !a->autoplace() || !slur->addToSkyline()) {
             continue;
         }
-        Shape aShape = a->shape().translate(a->pos() + item->pos() + s->pos() + m->pos());
-        Shape sShape = ss->shape().translate(ss->pos());
+        Shape aShape = a->shape().translated(a->pos() + item->pos() + s->pos() + m->pos());
+        Shape sShape = ss->shape().translated(ss->pos());
         if (aShape.intersects(sShape)) {
             double d = ctx.conf().styleS(Sid::articulationMinDistance).val() * item->spatium();
             d += slur->up()
@@ -3053,7 +3053,7 @@ void ChordLayout::resolveRestVSChord(std::vector<Rest*>& rests, std::vector<Chor
                             : chordShape.verticalClearance(restShape);
             } else {
                 Note* limitNote = restAbove ? chord->upNote() : chord->downNote();
-                Shape noteShape = limitNote->shape().translate(limitNote->pos());
+                Shape noteShape = limitNote->shape().translated(limitNote->pos());
                 clearance = restAbove ? noteShape.top() - restShape.bottom() : restShape.top() - noteShape.bottom();
                 minRestToChordClearance = 0.0;
             }
@@ -3417,7 +3417,7 @@ void ChordLayout::layoutNote2(Note* item, LayoutContext& ctx)
             LedgerLine* ledger = item->line() < -1 || item->line() > item->staff()->lines(item->tick())
                                  ? item->chord()->ledgerLines() : nullptr;
             if (ledger) {
-                noteShape.add(ledger->shape().translate(ledger->pos() - item->pos()));
+                noteShape.add(ledger->shape(), ledger->pos() - item->pos());
             }
             double right = noteShape.right();
             double left = noteShape.left();
@@ -3564,7 +3564,7 @@ Shape ChordLayout::chordRestShape(const ChordRest* item, const LayoutConfigurati
 
 void ChordLayout::fillShape(const Chord* item, ChordRest::LayoutData* ldata, const LayoutConfiguration& conf)
 {
-    Shape shape(Shape::Type::Composite);
+    ScratchShape shape;
 
     Hook* hook = item->hook();
     if (hook) {
@@ -3589,36 +3589,36 @@ void ChordLayout::fillShape(const Chord* item, ChordRest::LayoutData* ldata, con
     BeamSegment* beamlet = item->beamlet();
 
     if (hook && hook->addToSkyline()) {
-        shape.add(hook->shape().translate(hook->pos()));
+        shape->add(hook->shape(), hook->pos());
     }
 
     if (stem && stem->addToSkyline()) {
-        shape.add(stem->shape().translate(stem->pos()));
+        shape->add(stem->shape(), stem->pos());
     }
 
     if (stemSlash && stemSlash->addToSkyline()) {
-        shape.add(stemSlash->shape().translate(stemSlash->pos()));
+        shape->add(stemSlash->shape(), stemSlash->pos());
     }
 
     if (arpeggio && arpeggio->addToSkyline()) {
-        shape.add(arpeggio->shape().translate(arpeggio->pos()));
+        shape->add(arpeggio->shape(), arpeggio->pos());
     }
 //      if (_tremolo)
 //            shape.add(_tremolo->shape().translated(_tremolo->pos()));
     for (Note* note : item->notes()) {
-        shape.add(note->shape().translate(note->pos()));
+        shape->add(note->shape(), note->pos());
     }
 
     for (EngravingItem* e : item->el()) {
         if (e->addToSkyline()) {
-            shape.add(e->shape().translate(e->pos()));
+            shape->add(e->shape(), e->pos());
         }
     }
 
-    shape.add(chordRestShape(item, conf));      // add lyrics
+    shape->add(chordRestShape(item, conf));      // add lyrics
 
     for (const LedgerLine* l = item->ledgerLines(); l; l = l->next()) {
-        shape.add(l->shape().translate(l->pos()));
+        shape->add(l->shape(), l->pos());
     }
 
     if (beamlet && stem) {
@@ -3628,31 +3628,31 @@ void ChordLayout::fillShape(const Chord* item, ChordRest::LayoutData* ldata, con
         } else if (!beamlet->isBefore && item->up()) {
             xPos += stem->width();
         }
-        shape.add(beamlet->shape().translated(PointF(-xPos, 0.0)));
+        shape->add(beamlet->shape(), PointF(-xPos, 0.0));
     }
 
-    ldata->setShape(shape);
+    ldata->setShape(*shape);
 }
 
 void ChordLayout::fillShape(const Rest* item, Rest::LayoutData* ldata, const LayoutConfiguration& conf)
 {
-    Shape shape(Shape::Type::Composite);
+    ScratchShape shape;
 
     if (!item->isGap()) {
-        shape.add(chordRestShape(item, conf));
-        shape.add(item->symBbox(ldata->sym()), item);
+        shape->add(chordRestShape(item, conf));
+        shape->add(item->symBbox(ldata->sym()), item);
         for (const NoteDot* dot : item->dotList()) {
-            shape.add(item->symBbox(SymId::augmentationDot).translated(dot->pos()), dot);
+            shape->add(item->symBbox(SymId::augmentationDot).translated(dot->pos()), dot);
         }
     }
 
     for (const EngravingItem* e : item->el()) {
         if (e->addToSkyline()) {
-            shape.add(e->shape().translate(e->pos()));
+            shape->add(e->shape(), e->pos());
         }
     }
 
-    ldata->setShape(shape);
+    ldata->setShape(*shape);
 }
 
 void ChordLayout::fillShape(const MeasureRepeat* item, MeasureRepeat::LayoutData* ldata, const LayoutConfiguration&)
@@ -364,7 +364,7 @@ void HorizontalSpacing::computeNotePadding(const Note* note, const EngravingItem
 
     bool sameVoiceNoteOrStem = (item2->isNote() || item2->isStem()) && note->track() == item2->track();
     if (sameVoiceNoteOrStem) {
-        bool intersection = note->shape().translate(note->pos()).intersects(item2->shape().translate(item2->pos()));
+        bool intersection = note->shape().translated(note->pos()).intersects(item2->shape().translated(item2->pos()));
         if (intersection) {
             padding = std::max(padding, static_cast<double>(style.styleMM(Sid::minNoteDistance)));
         }
@@ -379,7 +379,7 @@ void PageLayout::collectPage(LayoutContext& ctx)
         }
     }
 
-    ctx.mutState().page()->invalidateBspTree();
+    ctx.mutState().page()->invalidateSpatialIndex();
 }
 
 //---------------------------------------------------------
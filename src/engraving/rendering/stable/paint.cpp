@@ -212,7 +212,6 @@ void Paint::paintItem(mu::draw::Painter& painter, const EngravingItem* item)
     if (item->ldata()->isSkipDraw()) {
         return;
     }
-    item->itemDiscovered = false;
     PointF itemPosition(item->pagePos());
 
     painter.translate(itemPosition);
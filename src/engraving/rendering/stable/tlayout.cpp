@@ -534,6 +534,10 @@ void TLayout::layoutAccidental(const Accidental* item, Accidental::LayoutData* l
             ldata->addBbox(item->symBbox(bracketSyms.second).translated(x, 0.0));
         }
     }
+
+    //! NOTE The shape of an accidental is just its bbox
+    const RectF bbox = ldata->bbox();
+    ldata->setBbox(bbox);
 }
 
 void TLayout::layoutActionIcon(const ActionIcon* item, ActionIcon::LayoutData* ldata)
@@ -1903,7 +1907,7 @@ void TLayout::layoutExpression(const Expression* item, Expression::LayoutData* l
 
     // If there is a dynamic on same segment and track, lock this expression to it
     double padding = item->computeDynamicExpressionDistance();
-    double dynamicRight = dynamic->shape().translate(dynamic->pos()).right();
+    double dynamicRight = dynamic->shape().translated(dynamic->pos()).right();
     double expressionLeft = ldata->bbox().translated(item->pos()).left();
     double difference = expressionLeft - dynamicRight - padding;
     ldata->moveX(-difference);
@@ -2784,7 +2788,7 @@ void TLayout::layoutGraceNotesGroup2(const GraceNotesGroup* item, GraceNotesGrou
         LD_CONDITION(grace->ldata()->isSetShape());
         LD_CONDITION(grace->ldata()->isSetPos());
 
-        shape.add(grace->shape(LD_ACCESS::PASS).translate(grace->pos() - item->pos()));
+        shape.add(grace->shape(LD_ACCESS::PASS), grace->pos() - item->pos());
     }
     ldata->setShape(shape);
 }
@@ -2836,7 +2840,7 @@ void TLayout::layoutGuitarBendSegment(GuitarBendSegment* item, LayoutContext& ct
     SysStaff* staff = item->system()->staff(item->staffIdx());
     Skyline& skyline = staff->skyline();
     SkylineLine& skylineLine = tabStaff ? skyline.north() : (item->guitarBend()->ldata()->up() ? skyline.north() : skyline.south());
-    skylineLine.add(item->shape().translated(item->pos()));
+    skylineLine.add(item->shape(), item->pos());
 
     fillGuitarBendSegmentShape(item, ldata);
 }
@@ -2846,7 +2850,7 @@ void TLayout::fillGuitarBendSegmentShape(const GuitarBendSegment* item, GuitarBe
     Shape shape;
     shape.add(ldata->bbox(), item);
     if (!item->bendText()->empty()) {
-        shape.add(item->bendText()->shape().translated(item->bendText()->pos()));
+        shape.add(item->bendText()->shape(), item->bendText()->pos());
     }
     ldata->setShape(shape);
 }
@@ -4229,7 +4233,7 @@ void TLayout::fillNoteShape(const Note* item, Note::LayoutData* ldata)
             // isn't fully known yet, so we use an approximation
             double sp = item->spatium();
             PointF approxRelPos(noteBBox.width() + 0.25 * sp, -0.25 * sp);
-            shape.add(bendSeg->shape().translated(approxRelPos));
+            shape.add(bendSeg->shape(), approxRelPos);
         }
     }
 
@@ -4287,7 +4291,7 @@ void TLayout::layoutOrnament(const Ornament* item, Ornament::LayoutData* ldata,
         if (accidental && accidental->visible()) {
             LD_CONDITION(accidental->ldata()->isSetShape());
             LD_CONDITION(accidental->ldata()->isSetPos());
-            sh.add(accidental->shape().translate(accidental->pos()));
+            sh.add(accidental->shape(), accidental->pos());
         }
     }
 
@@ -6072,7 +6076,7 @@ void TLayout::fillTrillSegmentShape(const TrillSegment* item, TrillSegment::Layo
     Shape s = font->shape(item->symbols(), item->magS());
     Accidental* accidental = item->trill()->accidental();
     if (accidental && accidental->visible() && item->isSingleBeginType()) {
-        s.add(accidental->shape().translate(accidental->pos()));
+        s.add(accidental->shape(), accidental->pos());
     }
 
     ldata->setShape(s);
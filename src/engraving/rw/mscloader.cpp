@@ -25,6 +25,7 @@
 #include <map>
 
 #include "global/io/buffer.h"
+#include "global/concurrency/taskscheduler.h"
 #include "global/types/retval.h"
 
 #include "types/types.h"
@@ -71,6 +72,16 @@ static RetVal<IReaderPtr> makeReader(int version, bool ignoreVersionError)
     return RetVal<IReaderPtr>::make_ok(RWRegister::reader(version));
 }
 
+MscLoader::MscLoader()
+    : m_taskScheduler(TaskScheduler::instance())
+{
+}
+
+void MscLoader::setTaskScheduler(TaskScheduler* scheduler)
+{
+    m_taskScheduler = scheduler;
+}
+
 mu::Ret MscLoader::loadMscz(MasterScore* masterScore, const MscReader& mscReader, SettingsCompat& settingsCompat,
                             bool ignoreVersionError)
 {
@@ -105,11 +116,19 @@ mu::Ret MscLoader::loadMscz(MasterScore* masterScore, const MscReader& mscReader
     }
 
     // Read images
+    //! NOTE Images stored under their hash names are only registered here,
+    //! their data is decompressed after reading the score, and only for the used ones
+    std::vector<std::pair<ImageStoreItem*, String> > lazyImages;
     {
         if (!MScore::noImages) {
             std::vector<String> images = mscReader.imageFileNames();
             for (const String& name : images) {
-                imageStore.add(name, mscReader.readImageFile(name));
+                ImageStoreItem* item = imageStore.addLazy(name);
+                if (!item) {
+                    imageStore.add(name, mscReader.readImageFile(name));
+                } else if (!item->loaded()) {
+                    lazyImages.push_back({ item, name });
+                }
             }
         }
     }
@@ -133,8 +152,8 @@ mu::Ret MscLoader::loadMscz(MasterScore* masterScore, const MscReader& mscReader
 
     // Read excerpts
     if (ret && masterScore->mscVersion() >= 400) {
-        std::vector<String> excerptNames = mscReader.excerptNames();
-        for (const String& excerptName : excerptNames) {
+        std::vector<ExcerptFile> excerptFiles = readExcerptFiles(mscReader);
+        for (ExcerptFile& excerptFile : excerptFiles) {
             Score* partScore = masterScore->createScore();
 
             compat::ReadStyleHook::setupDefaultStyle(partScore);
@@ -142,15 +161,12 @@ mu::Ret MscLoader::loadMscz(MasterScore* masterScore, const MscReader& mscReader
             Excerpt* ex = new Excerpt(masterScore);
             ex->setExcerptScore(partScore);
 
-            ByteArray excerptStyleData = mscReader.readExcerptStyleFile(excerptName);
+            ByteArray excerptStyleData = mscReader.readExcerptStyleFile(excerptFile.name);
             Buffer excerptStyleBuf(&excerptStyleData);
             excerptStyleBuf.open(IODevice::ReadOnly);
             partScore->style().read(&excerptStyleBuf);
 
-            ByteArray excerptData = mscReader.readExcerptFile(excerptName);
-
-            XmlReader xml(excerptData);
-            xml.setDocName(excerptName);
+            XmlReader& xml = *excerptFile.xml;
 
             ReadInOutData partReadInData;
             partReadInData.links = masterReadOutData.links;
@@ -169,9 +185,21 @@ mu::Ret MscLoader::loadMscz(MasterScore* masterScore, const MscReader& mscReader
 
             partScore->linkMeasures(masterScore);
 
-            ex->setName(excerptName);
+            ex->setName(excerptFile.name);
 
             masterScore->addExcerpt(ex);
+
+            //! NOTE Release the parsed document as soon as it is read
+            excerptFile.xml.reset();
+        }
+    }
+
+    // Load used images
+    for (auto& [item, name] : lazyImages) {
+        if (item->isUsed()) {
+            item->set(mscReader.readImageFile(name), item->hash());
+        } else {
+            imageStore.remove(item);
         }
     }
 
@@ -192,6 +220,46 @@ mu::Ret MscLoader::loadMscz(MasterScore* masterScore, const MscReader& mscReader
     return ret;
 }
 
+std::vector<MscLoader::ExcerptFile> MscLoader::readExcerptFiles(const MscReader& mscReader) const
+{
+    TRACEFUNC;
+
+    std::vector<String> excerptNames = mscReader.excerptNames();
+
+    std::vector<ExcerptFile> files;
+    files.resize(excerptNames.size());
+
+    auto readFile = [&mscReader](ExcerptFile& file, const String& name) {
+        file.name = name;
+        file.xml = std::make_unique<XmlReader>(mscReader.readExcerptFile(name));
+        file.xml->setDocName(name);
+    };
+
+    if (!m_taskScheduler || excerptNames.size() < 2) {
+        for (size_t i = 0; i < excerptNames.size(); ++i) {
+            readFile(files[i], excerptNames[i]);
+        }
+        return files;
+    }
+
+    //! NOTE Unpacking and parsing of the excerpt files does not touch the score,
+    //! so it is done concurrently; reading into the scores and resolving links stays serial
+
+    std::vector<std::future<void> > results;
+    results.reserve(excerptNames.size());
+    for (size_t i = 0; i < excerptNames.size(); ++i) {
+        results.push_back(m_taskScheduler->submit([&readFile, &files, &excerptNames, i]() {
+            readFile(files[i], excerptNames[i]);
+        }));
+    }
+
+    for (std::future<void>& result : results) {
+        result.wait();
+    }
+
+    return files;
+}
+
 mu::Ret MscLoader::readMasterScore(MasterScore* score, XmlReader& e, bool ignoreVersionError, ReadInOutData* out,
                                    compat::ReadStyleHook* styleHook)
 {
@@ -22,11 +22,18 @@
 #ifndef MU_ENGRAVING_MSCLOADER_H
 #define MU_ENGRAVING_MSCLOADER_H
 
+#include <memory>
+#include <vector>
+
 #include "global/types/ret.h"
 
 #include "infrastructure/mscreader.h"
 #include "engraving/types/types.h"
 
+namespace mu {
+class TaskScheduler;
+}
+
 namespace mu::engraving::compat {
 class ReadStyleHook;
 }
@@ -41,14 +48,29 @@ class XmlReader;
 class MscLoader
 {
 public:
-    MscLoader() = default;
+    MscLoader();
+
+    //! NOTE The excerpt files are unpacked and parsed on this scheduler,
+    //! by default it is the shared scheduler of the application, if null they are read one by one
+    void setTaskScheduler(TaskScheduler* scheduler);
 
     Ret loadMscz(MasterScore* score, const MscReader& mscReader, SettingsCompat& settingsCompat, bool ignoreVersionError);
 
 private:
     friend class MasterScore;
+
+    struct ExcerptFile
+    {
+        String name;
+        std::unique_ptr<XmlReader> xml;
+    };
+
+    std::vector<ExcerptFile> readExcerptFiles(const MscReader& mscReader) const;
+
     Ret readMasterScore(MasterScore* score, XmlReader&, bool ignoreVersionError, rw::ReadInOutData* out = nullptr,
                         compat::ReadStyleHook* styleHook = nullptr);
+
+    TaskScheduler* m_taskScheduler = nullptr;
 };
 }
 
@@ -234,13 +234,13 @@ bool Read410::readScore410(Score* score, XmlReader& e, ReadContext& ctx)
                 score->excerpt()->setName(n);
             }
         } else if (tag == "layoutMode") {
-            String s = e.readText();
+            AsciiStringView s = e.readAsciiText();
             if (s == "line") {
                 score->setLayoutMode(LayoutMode::LINE);
             } else if (s == "system") {
                 score->setLayoutMode(LayoutMode::SYSTEM);
             } else {
-                LOGD("layoutMode: %s", muPrintable(s));
+                LOGD("layoutMode: %s", s.ascii());
             }
         } else {
             e.unknown();
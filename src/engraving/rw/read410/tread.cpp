@@ -222,7 +222,7 @@ PropertyValue TRead::readPropertyValue(Pid id, XmlReader& e, ReadContext& ctx)
         return PropertyValue(e.readText());
 
     case P_TYPE::ALIGN:
-        return PropertyValue(TConv::fromXml(e.readText(), Align()));
+        return PropertyValue(TConv::fromXml(e.readAsciiText(), Align()));
     case P_TYPE::PLACEMENT_V:
         return PropertyValue(TConv::fromXml(e.readAsciiText(), PlacementV::ABOVE));
     case P_TYPE::PLACEMENT_H:
@@ -390,7 +390,7 @@ bool TRead::readItemProperties(EngravingItem* item, XmlReader& e, ReadContext& c
                 const AsciiStringView ntag(e.name());
 
                 if (ntag == "score") {
-                    String val(e.readText());
+                    AsciiStringView val(e.readAsciiText());
                     if (val == "same") {
                         linkedIsMaster = item->score()->isMaster();
                     }
@@ -1256,7 +1256,7 @@ void TRead::read(KeySig* s, XmlReader& e, ReadContext& ctx)
             e.readInt();
             sig.setCustom(true);
         } else if (tag == "mode") {
-            String m(e.readText());
+            AsciiStringView m(e.readAsciiText());
             if (m == "none") {
                 sig.setMode(KeyMode::NONE);
             } else if (m == "major") {
@@ -3410,7 +3410,7 @@ bool TRead::readProperties(Part* p, XmlReader& e, ReadContext& ctx)
     } else if (tag == "soloist") {
         p->setSoloist(e.readInt());
     } else if (tag == "preferSharpFlat") {
-        String val = e.readText();
+        AsciiStringView val = e.readAsciiText();
         if (val == "sharps") {
             p->setPreferSharpFlat(PreferSharpFlat::SHARPS);
         } else if (val == "flats") {
@@ -61,7 +61,17 @@ Millimetre MStyle::valueMM(Sid idx) const
         return Millimetre();
     }
 
-    return m_precomputedValues[size_t(idx)];
+    return Millimetre(m_resolvedValues[size_t(idx)].mm);
+}
+
+const MStyle::ResolvedValue& MStyle::resolvedValue(Sid idx) const
+{
+    if (idx == Sid::NOSTYLE) {
+        static const ResolvedValue dummy;
+        return dummy;
+    }
+
+    return m_resolvedValues[size_t(idx)];
 }
 
 void MStyle::set(const Sid t, const PropertyValue& val)
@@ -75,10 +85,7 @@ void MStyle::set(const Sid t, const PropertyValue& val)
     if (t == Sid::spatium) {
         precomputeValues();
     } else {
-        if (StyleDef::styleValues[idx].valueType() == P_TYPE::SPATIUM) {
-            double _spatium = value(Sid::spatium).toReal();
-            m_precomputedValues[idx] = m_values[idx].value<Spatium>().val() * _spatium;
-        }
+        resolveValue(t, value(Sid::spatium).toReal());
     }
 }
 
@@ -86,9 +93,33 @@ void MStyle::precomputeValues()
 {
     double _spatium = value(Sid::spatium).toReal();
     for (const StyleDef::StyleValue& t : StyleDef::styleValues) {
-        if (t.valueType() == P_TYPE::SPATIUM) {
-            m_precomputedValues[t.idx()] = value(t.styleIdx()).value<Spatium>().val() * _spatium;
+        resolveValue(t.styleIdx(), _spatium);
+    }
+}
+
+void MStyle::resolveValue(Sid idx, double spatium)
+{
+    const PropertyValue& val = value(idx);
+    ResolvedValue& resolved = m_resolvedValues[size_t(idx)];
+    resolved = ResolvedValue();
+
+    switch (StyleDef::styleValues[size_t(idx)].valueType()) {
+    case P_TYPE::SPATIUM:
+        resolved.real = val.value<Spatium>().val();
+        resolved.mm = resolved.real * spatium;
+        break;
+    case P_TYPE::REAL:
+        resolved.real = val.toReal();
+        break;
+    case P_TYPE::BOOL:
+    case P_TYPE::INT:
+        resolved.integer = val.toInt();
+        break;
+    default:
+        if (val.isEnum()) {
+            resolved.integer = val.toInt();
         }
+        break;
     }
 }
 
@@ -47,7 +47,15 @@ class XmlWriter;
 class MStyle
 {
 public:
-    MStyle() = default;
+    MStyle() { precomputeValues(); }
+
+    //! NOTE Value resolved to native types, kept up to date by set(),
+    //! so hot lookups (see LayoutConfiguration) don't need to go through PropertyValue
+    struct ResolvedValue {
+        double real = 0.0;      // REAL, SPATIUM (in spatium units)
+        double mm = 0.0;        // SPATIUM multiplied by the current spatium
+        int integer = 0;        // BOOL, INT and enums
+    };
 
     const PropertyValue& styleV(Sid idx) const { return value(idx); }
     Spatium styleS(Sid idx) const
@@ -64,6 +72,7 @@ public:
 
     const PropertyValue& value(Sid idx) const;
     Millimetre valueMM(Sid idx) const;
+    const ResolvedValue& resolvedValue(Sid idx) const;
 
     void set(Sid idx, const PropertyValue& v);
 
@@ -96,7 +105,9 @@ private:
     bool readTextStyleValCompat(XmlReader&);
 
     std::array<PropertyValue, size_t(Sid::STYLES)> m_values;
-    std::array<Millimetre, size_t(Sid::STYLES)> m_precomputedValues;
+    void resolveValue(Sid idx, double spatium);
+
+    std::array<ResolvedValue, size_t(Sid::STYLES)> m_resolvedValues;
 
     void readVersion(String versionTag);
     int m_version = 0;
@@ -0,0 +1,172 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2023 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <new>
+
+#include "io/dir.h"
+
+#include "dom/masterscore.h"
+#include "infrastructure/shape.h"
+
+#include "utils/scorerw.h"
+
+using namespace mu;
+using namespace mu::engraving;
+
+static const String VTEST_SCORES_DIR(u"/../../../vtest/scores");
+
+//! NOTE Counts the heap allocations of this executable.
+//! The array and nothrow forms of operator new call this one by default
+static std::atomic<size_t> s_allocationCount = 0;
+
+void* operator new(std::size_t size)
+{
+    s_allocationCount.fetch_add(1, std::memory_order_relaxed);
+
+    if (void* ptr = std::malloc(size ? size : 1)) {
+        return ptr;
+    }
+
+    throw std::bad_alloc();
+}
+
+void operator delete(void* ptr) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete(void* ptr, std::size_t) noexcept
+{
+    std::free(ptr);
+}
+
+static int* volatile s_allocated = nullptr;
+
+class Engraving_LayoutAllocationsTests : public ::testing::Test
+{
+public:
+    static size_t allocationCount()
+    {
+        return s_allocationCount.load(std::memory_order_relaxed);
+    }
+
+    static Shape elementShape(double x)
+    {
+        Shape shape(Shape::Type::Composite);
+        shape.add(RectF(x, 0.0, 2.0, 4.0));
+        shape.add(RectF(x, 4.0, 1.0, 8.0));
+        shape.add(RectF(x + 1.0, -2.0, 3.0, 2.0));
+        shape.add(RectF(x - 1.0, 12.0, 2.0, 1.0));
+        return shape;
+    }
+};
+
+TEST_F(Engraving_LayoutAllocationsTests, CounterWorks)
+{
+    //! [GIVEN] The current number of allocations
+    const size_t before = allocationCount();
+
+    //! [WHEN] Something is allocated
+    s_allocated = new int(1);
+    delete s_allocated;
+
+    //! [THEN] It is counted
+    EXPECT_EQ(allocationCount(), before + 1);
+}
+
+TEST_F(Engraving_LayoutAllocationsTests, ComposeShapeWithoutAllocations)
+{
+    //! [GIVEN] The element shapes of a segment and their positions
+    std::vector<Shape> shapes;
+    std::vector<PointF> positions;
+    for (int i = 0; i < 16; ++i) {
+        shapes.push_back(elementShape(i * 2.0));
+        positions.push_back(PointF(i * 0.5, i * -0.25));
+    }
+
+    auto compose = [&shapes, &positions]() {
+        ScratchShape shape;
+        for (size_t i = 0; i < shapes.size(); ++i) {
+            shape->add(shapes.at(i), positions.at(i));
+        }
+        return shape->bbox();
+    };
+
+    //! [GIVEN] The scratch shape of this thread has grown to the needed size
+    const RectF expected = compose();
+
+    //! [WHEN] The shape is composed again
+    const size_t before = allocationCount();
+    const RectF bbox = compose();
+
+    //! [THEN] Nothing is allocated
+    EXPECT_EQ(allocationCount(), before);
+    EXPECT_EQ(bbox, expected);
+}
+
+//! NOTE Benchmark, run with --gtest_also_run_disabled_tests.
+//! Lays out every vtest score (a full layout range) and reports the heap allocations per pass
+TEST_F(Engraving_LayoutAllocationsTests, DISABLED_LayoutAllocations)
+{
+    RetVal<io::paths_t> files = io::Dir::scanFiles(ScoreRW::rootPath() + VTEST_SCORES_DIR, { "*.mscz", "*.mscx" },
+                                                   io::ScanMode::FilesInCurrentDir);
+    ASSERT_TRUE(files.ret);
+
+    constexpr int ITERATIONS = 3;
+
+    size_t totalAllocations = 0;
+    double totalMs = 0.0;
+    size_t laidOut = 0;
+
+    for (const io::path_t& path : files.val) {
+        MasterScore* score = ScoreRW::readScore(path.toString(), true);
+        if (!score) {
+            continue;
+        }
+
+        //! NOTE The first pass fills the caches, it is not counted
+        score->doLayout();
+
+        for (int i = 0; i < ITERATIONS; ++i) {
+            const size_t before = allocationCount();
+            auto start = std::chrono::steady_clock::now();
+
+            score->doLayout();
+
+            totalMs += std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+            totalAllocations += allocationCount() - before;
+        }
+
+        ++laidOut;
+        delete score;
+    }
+
+    std::cout << "laid out " << laidOut << " vtest scores, "
+              << "allocations: " << totalAllocations / ITERATIONS << " per pass, "
+              << "total: " << totalMs / ITERATIONS << " ms per pass" << std::endl;
+}
@@ -0,0 +1,77 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2023 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include <gtest/gtest.h>
+
+#include "io/file.h"
+
+#include "engraving/internal/engravingfont.h"
+#include "engraving/types/symnames.h"
+
+using namespace mu;
+using namespace mu::engraving;
+
+static const io::path_t METRICS_CACHE_PATH("Bravura_test.metrics");
+
+class Engraving_EngravingFontTests : public ::testing::Test
+{
+};
+
+TEST_F(Engraving_EngravingFontTests, MetricsCache)
+{
+    io::File::remove(METRICS_CACHE_PATH);
+
+    // [GIVEN] The font loaded from the font file, the metrics are computed and stored
+    EngravingFont computed("Bravura", "Bravura", ":/fonts/bravura/Bravura.otf");
+    computed.setMetricsCachePath(METRICS_CACHE_PATH);
+    computed.ensureLoad();
+
+    EXPECT_FALSE(computed.isLoadedFromMetricsCache());
+    ASSERT_TRUE(io::File::exists(METRICS_CACHE_PATH));
+
+    // [WHEN] The same font is loaded again
+    EngravingFont cached("Bravura", "Bravura", ":/fonts/bravura/Bravura.otf");
+    cached.setMetricsCachePath(METRICS_CACHE_PATH);
+    cached.ensureLoad();
+
+    // [THEN] The metrics are read from the cache
+    ASSERT_TRUE(cached.isLoadedFromMetricsCache());
+
+    // [THEN] The metrics read from the cache are the same as the computed ones
+    for (int i = 0; i < static_cast<int>(SymId::lastSym); ++i) {
+        SymId id = static_cast<SymId>(i);
+        ASSERT_EQ(computed.isValid(id), cached.isValid(id)) << SymNames::nameForSymId(id).ascii();
+        if (!computed.isValid(id)) {
+            continue;
+        }
+
+        EXPECT_EQ(computed.symCode(id), cached.symCode(id));
+        EXPECT_EQ(computed.bbox(id, 1.0), cached.bbox(id, 1.0));
+        EXPECT_DOUBLE_EQ(computed.advance(id, 1.0), cached.advance(id, 1.0));
+        EXPECT_EQ(computed.smuflAnchor(id, SmuflAnchorId::stemUpSE, 1.0), cached.smuflAnchor(id, SmuflAnchorId::stemUpSE, 1.0));
+        EXPECT_EQ(computed.smuflAnchor(id, SmuflAnchorId::cutOutNW, 1.0), cached.smuflAnchor(id, SmuflAnchorId::cutOutNW, 1.0));
+    }
+
+    EXPECT_EQ(computed.engravingDefaults(), cached.engravingDefaults());
+    EXPECT_DOUBLE_EQ(computed.textEnclosureThickness(), cached.textEnclosureThickness());
+
+    io::File::remove(METRICS_CACHE_PATH);
+}
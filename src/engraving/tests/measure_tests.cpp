@@ -22,6 +22,8 @@
 
 #include <gtest/gtest.h>
 
+#include <chrono>
+
 #include "dom/engravingitem.h"
 #include "dom/masterscore.h"
 #include "dom/measure.h"
@@ -567,3 +569,85 @@ TEST_F(Engraving_MeasureTests, measureNumbers)
 
     delete score;
 }
+
+static Measure* tick2measureLinear(const Score* score, const Fraction& tick)
+{
+    Measure* lm = nullptr;
+    for (Measure* m = score->firstMeasure(); m; m = m->nextMeasure()) {
+        if (tick < m->tick()) {
+            return lm;
+        }
+        lm = m;
+    }
+    return lm && tick <= lm->endTick() ? lm : nullptr;
+}
+
+TEST_F(Engraving_MeasureTests, tick2measureIndex)
+{
+    MasterScore* score = ScoreRW::readScore(MEASURE_DATA_DIR + u"measure-1.mscx");
+    EXPECT_TRUE(score);
+
+    auto checkAllTicks = [score]() {
+        for (Measure* m = score->firstMeasure(); m; m = m->nextMeasure()) {
+            EXPECT_EQ(score->tick2measure(m->tick()), m);
+            Fraction mid = m->tick() + m->ticks() * Fraction(1, 2);
+            EXPECT_EQ(score->tick2measure(mid), tick2measureLinear(score, mid));
+
+            for (Segment* s = m->first(); s; s = s->next()) {
+                EXPECT_EQ(m->findSegmentR(s->segmentType(), s->rtick()), s);
+                EXPECT_EQ(m->tick2segment(s->tick(), s->segmentType()), s);
+            }
+        }
+        Measure* last = score->lastMeasure();
+        EXPECT_EQ(score->tick2measure(last->endTick()), last);
+        EXPECT_EQ(score->tick2measure(last->endTick() + Fraction(1, 4)), nullptr);
+    };
+
+    checkAllTicks();
+
+    // the index is updated after measures are inserted and removed
+    score->startCmd();
+    score->insertMeasure(score->firstMeasure()->nextMeasure());
+    score->appendMeasures(40);
+    score->endCmd();
+    checkAllTicks();
+
+    score->undoRedo(true, nullptr);
+    checkAllTicks();
+
+    delete score;
+}
+
+//! NOTE Shows that tick2measure/tick2segment cost does not grow with the score length,
+//! run with --gtest_also_run_disabled_tests --gtest_filter=*tick2measureBenchmark*
+TEST_F(Engraving_MeasureTests, DISABLED_tick2measureBenchmark)
+{
+    MasterScore* score = ScoreRW::readScore(MEASURE_DATA_DIR + u"measure-1.mscx");
+    EXPECT_TRUE(score);
+
+    constexpr int LOOKUPS = 200000;
+
+    for (int measures : { 100, 1000, 5000 }) {
+        score->startCmd();
+        score->appendMeasures(measures - static_cast<int>(score->nmeasures()));
+        score->endCmd();
+
+        const Fraction endTick = score->lastMeasure()->endTick();
+        const int ticks = endTick.ticks();
+
+        size_t found = 0;
+        auto start = std::chrono::steady_clock::now();
+        for (int i = 0; i < LOOKUPS; ++i) {
+            Fraction tick = Fraction::fromTicks(int((int64_t(i) * 7919) % ticks));
+            if (score->tick2segment(tick, true, SegmentType::ChordRest)) {
+                ++found;
+            }
+        }
+        auto end = std::chrono::steady_clock::now();
+
+        double ns = std::chrono::duration<double, std::nano>(end - start).count() / LOOKUPS;
+        std::cout << score->nmeasures() << " measures: " << ns << " ns per tick2segment lookup, found: " << found << std::endl;
+    }
+
+    delete score;
+}
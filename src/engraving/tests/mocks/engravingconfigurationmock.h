@@ -31,6 +31,7 @@ class EngravingConfigurationMock : public IEngravingConfiguration
 {
 public:
     MOCK_METHOD(io::path_t, appDataPath, (), (const, override));
+    MOCK_METHOD(io::path_t, fontMetricsCachePath, (), (const, override));
 
     MOCK_METHOD(io::path_t, defaultStyleFilePath, (), (const, override));
     MOCK_METHOD(void, setDefaultStyleFilePath, (const io::path_t&), (override));
@@ -81,6 +82,10 @@ public:
     MOCK_METHOD(void, setGuitarProMultivoiceEnabled, (bool), (override));
     MOCK_METHOD(bool, guitarProMultivoiceEnabled, (), (const, override));
     MOCK_METHOD(bool, minDistanceForPartialSkylineCalculated, (), (const, override));
+
+    MOCK_METHOD(size_t, undoHistoryMaxSteps, (), (const, override));
+    MOCK_METHOD(size_t, undoHistoryMaxMemory, (), (const, override));
+    MOCK_METHOD(async::Notification, undoHistoryLimitsChanged, (), (const, override));
 };
 }
 
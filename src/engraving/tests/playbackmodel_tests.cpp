@@ -26,6 +26,7 @@
 
 #include "async/asyncable.h"
 #include "async/channel.h"
+#include "async/processevents.h"
 #include "mpe/tests/utils/articulationutils.h"
 #include "mpe/tests/mocks/articulationprofilesrepositorymock.h"
 
@@ -584,13 +585,65 @@ TEST_F(Engraving_PlaybackModelTests, Multi_Measure_Repeat)
     EXPECT_EQ(result.size(), expectedSize);
 }
 
+/**
+ * @brief PlaybackModelTests_Deferred_Rendering
+ * @details In this case we're loading the score from the Multi_Measure_Repeat test with deferred rendering enabled
+ *          Only the first chunk is rendered by load(), the rest should be rendered on the next event loop iterations
+ *          In the end, the events have to be the same as when rendering the whole score at once
+ */
+TEST_F(Engraving_PlaybackModelTests, Deferred_Rendering)
+{
+    // [GIVEN] Simple piece of score (Violin, 4/4, 120 bpm, Treble Cleff)
+    Score* score = ScoreRW::readScore(PLAYBACK_MODEL_TEST_FILES_DIR + "multi_measure_repeat/multi_measure_repeat.mscx");
+
+    ASSERT_TRUE(score);
+    ASSERT_EQ(score->parts().size(), 1);
+
+    const Part* part = score->parts().at(0);
+    ASSERT_TRUE(part);
+
+    // [GIVEN] Expected amount of events - 8 measures of 4 quarter notes, 1 final note
+    int expectedSize = 8 * 4 + 1;
+
+    // [WHEN] The articulation profiles repository will be returning profiles for StringsArticulation family
+    EXPECT_CALL(*m_repositoryMock, defaultProfile(_)).WillRepeatedly(Return(m_defaultProfile));
+
+    // [GIVEN] The playback model which renders the whole score at once
+    PlaybackModel referenceModel;
+    referenceModel.setprofilesRepository(m_repositoryMock);
+    referenceModel.load(score);
+
+    const PlaybackEventsMap& expectedEvents
+        = referenceModel.resolveTrackPlaybackData(part->id(), part->instrumentId().toStdString()).originEvents;
+    ASSERT_EQ(expectedEvents.size(), expectedSize);
+
+    // [WHEN] The playback model requested to be loaded with deferred rendering by chunks of 2 measures
+    PlaybackModel model;
+    model.setprofilesRepository(m_repositoryMock);
+    model.setDeferredRendering(true, 2);
+    model.load(score);
+
+    const PlaybackEventsMap& result = model.resolveTrackPlaybackData(part->id(), part->instrumentId().toStdString()).originEvents;
+
+    // [THEN] Only the first chunk has been rendered so far
+    EXPECT_LT(result.size(), expectedSize);
+
+    // [WHEN] The remaining chunks are rendered
+    for (size_t i = 0; i < score->nmeasures(); ++i) {
+        async::processEvents();
+    }
+
+    // [THEN] The events match the ones rendered at once
+    EXPECT_EQ(result, expectedEvents);
+}
+
 /**
  * @brief PlaybackModelTests_SimpleRepeat_Changes_Notification
  * @details In this case we're building up a playback model of a simple score - Violin, 4/4, 120bpm, Treble Cleff, 4 measures
  *          Additionally, there is a simple repeat from measure 2 up to measure 3. In total, we'll be playing 6 measures overall
  *
- *          When the model will be loaded we'll emulate a change notification on the 2-nd measure, so that there will be updated events
- *          on the main stream channel
+ *          When the model will be loaded we'll emulate a change notification on the 2-nd measure, so that there will be
+ *          a partial update (delta) of the events on the main stream channel instead of the whole events map
  */
 TEST_F(Engraving_PlaybackModelTests, SimpleRepeat_Changes_Notification)
 {
@@ -607,8 +660,8 @@ TEST_F(Engraving_PlaybackModelTests, SimpleRepeat_Changes_Notification)
     // [GIVEN] The articulation profiles repository will be returning profiles for StringsArticulation family
     ON_CALL(*m_repositoryMock, defaultProfile(ArticulationFamily::Strings)).WillByDefault(Return(m_defaultProfile));
 
-    // [GIVEN] Expected amount of changed events
-    int expectedChangedEventsCount = 24;
+    // [GIVEN] Expected amount of events after the change
+    size_t expectedEventsCount = 24;
 
     // [GIVEN] The playback model requested to be loaded
     PlaybackModel model;
@@ -616,10 +669,23 @@ TEST_F(Engraving_PlaybackModelTests, SimpleRepeat_Changes_Notification)
     model.load(score);
 
     PlaybackData result = model.resolveTrackPlaybackData(part->id(), part->instrumentId().toStdString());
+    PlaybackEventsMap receivedEvents = result.originEvents;
+
+    bool isWholeMapReceived = false;
+    bool isDeltaReceived = false;
 
-    // [THEN] Updated events map will match our expectations
-    result.mainStream.onReceive(this, [expectedChangedEventsCount](const PlaybackEventsMap& updatedEvents) {
-        EXPECT_EQ(updatedEvents.size(), expectedChangedEventsCount);
+    result.mainStream.onReceive(this, [&isWholeMapReceived](const PlaybackEventsMap&) {
+        isWholeMapReceived = true;
+    });
+
+    result.mainStreamDelta.onReceive(this, [&isDeltaReceived, &receivedEvents](const PlaybackEventsDelta& delta) {
+        isDeltaReceived = true;
+
+        // [THEN] All the events of the delta are within its ranges
+        EXPECT_FALSE(delta.ranges.empty());
+        EXPECT_EQ(playbackEventsInRanges(delta.events, delta.ranges), delta.events);
+
+        applyPlaybackEventsDelta(receivedEvents, delta);
     });
 
     // [WHEN] Notation has been changed on the 2-nd measure
@@ -631,6 +697,18 @@ TEST_F(Engraving_PlaybackModelTests, SimpleRepeat_Changes_Notification)
     range.changedTypes = { ElementType::NOTE };
 
     score->changesChannel().send(range);
+
+    // [THEN] Only the delta has been sent
+    EXPECT_TRUE(isDeltaReceived);
+    EXPECT_FALSE(isWholeMapReceived);
+
+    // [THEN] The events with the applied delta match the updated events of the model
+    const PlaybackData& updatedResult = model.resolveTrackPlaybackData(part->id(), part->instrumentId().toStdString());
+    EXPECT_EQ(receivedEvents.size(), expectedEventsCount);
+    EXPECT_EQ(receivedEvents, updatedResult.originEvents);
+
+    result.mainStream.resetOnReceive(this);
+    result.mainStreamDelta.resetOnReceive(this);
 }
 
 /**
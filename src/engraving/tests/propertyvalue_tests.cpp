@@ -0,0 +1,175 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2023 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <iostream>
+
+#include "io/dir.h"
+
+#include "engraving/compat/scoreaccess.h"
+#include "engraving/compat/mscxcompat.h"
+#include "engraving/dom/masterscore.h"
+#include "engraving/infrastructure/localfileinfoprovider.h"
+#include "engraving/types/propertyvalue.h"
+
+#include "utils/scorerw.h"
+
+#include "log.h"
+
+using namespace mu;
+using namespace mu::engraving;
+
+static const String ALL_ELEMENTS_DATA_DIR("all_elements_data/");
+static const String VTEST_SCORES_DIR(u"/../../../vtest/scores");
+
+class Engraving_PropertyValueTests : public ::testing::Test
+{
+};
+
+TEST_F(Engraving_PropertyValueTests, InlineValues)
+{
+    PropertyValue b(true);
+    PropertyValue i(42);
+    PropertyValue s(String(u"text"));
+    PropertyValue d(DirectionV::UP);
+    PropertyValue sp(Spatium(1.5));
+
+    //! NOTE copy keeps the value
+    PropertyValue i2 = i;
+    EXPECT_EQ(i2.type(), P_TYPE::INT);
+    EXPECT_EQ(i2.value<int>(), 42);
+    EXPECT_EQ(i2, i);
+
+    //! NOTE move leaves the source undefined
+    PropertyValue s2 = s;
+    PropertyValue s3 = std::move(s2);
+    EXPECT_EQ(s3.value<String>(), u"text");
+    EXPECT_EQ(s3, s);
+    EXPECT_FALSE(s2.isValid());
+
+    EXPECT_EQ(b.value<int>(), 1);
+    EXPECT_TRUE(d.isEnum());
+    EXPECT_EQ(d.value<int>(), static_cast<int>(DirectionV::UP));
+    EXPECT_DOUBLE_EQ(sp.value<double>(), 1.5);
+    EXPECT_NE(i, PropertyValue(43));
+
+    i2 = s;
+    EXPECT_EQ(i2.type(), P_TYPE::STRING);
+    EXPECT_EQ(i2, s);
+}
+
+TEST_F(Engraving_PropertyValueTests, HeapValues)
+{
+    std::vector<int> vec = { 1, 2, 3 };
+    PropertyValue v(vec);
+    PropertyValue v2 = v;
+    EXPECT_EQ(v2.value<std::vector<int> >(), vec);
+    EXPECT_EQ(v2, v);
+
+    PropertyValue v3 = std::move(v2);
+    EXPECT_EQ(v3, v);
+    EXPECT_FALSE(v2.isValid());
+
+    v3 = PropertyValue(1);
+    EXPECT_EQ(v3.value<int>(), 1);
+    EXPECT_EQ(v.value<std::vector<int> >(), vec);
+}
+
+static void collectItems(void* data, EngravingItem* e)
+{
+    static_cast<std::vector<EngravingItem*>*>(data)->push_back(e);
+}
+
+//! NOTE Measures getProperty/setProperty round trips on all items of a score,
+//! run with --gtest_also_run_disabled_tests --gtest_filter=*PropertyValue*
+TEST_F(Engraving_PropertyValueTests, DISABLED_GetSetPropertyBenchmark)
+{
+    MasterScore* score = ScoreRW::readScore(ALL_ELEMENTS_DATA_DIR + u"layout_elements.mscx");
+    ASSERT_TRUE(score);
+    score->doLayout();
+
+    std::vector<EngravingItem*> items;
+    score->scanElements(&items, collectItems, true);
+    ASSERT_FALSE(items.empty());
+
+    static const Pid PIDS[] = { Pid::VISIBLE, Pid::Z, Pid::COLOR, Pid::OFFSET, Pid::PLACEMENT, Pid::AUTOPLACE };
+
+    constexpr int ITERATIONS = 200;
+
+    size_t calls = 0;
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < ITERATIONS; ++i) {
+        for (EngravingItem* item : items) {
+            for (Pid pid : PIDS) {
+                PropertyValue v = item->getProperty(pid);
+                if (v.isValid()) {
+                    item->setProperty(pid, v);
+                }
+                ++calls;
+            }
+        }
+    }
+    auto end = std::chrono::steady_clock::now();
+
+    double ms = std::chrono::duration<double, std::milli>(end - start).count();
+    std::cout << "get/set property: " << calls << " calls on " << items.size() << " items, "
+              << ms << " ms, " << (ms > 0.0 ? calls / ms * 1000.0 : 0.0) << " calls per second" << std::endl;
+
+    delete score;
+}
+
+//! NOTE Measures reading and full layout of all vtest scores separately
+TEST_F(Engraving_PropertyValueTests, DISABLED_LoadAndLayoutBenchmark)
+{
+    RetVal<io::paths_t> files = io::Dir::scanFiles(ScoreRW::rootPath() + VTEST_SCORES_DIR, { "*.mscz", "*.mscx" },
+                                                   io::ScanMode::FilesInCurrentDir);
+    ASSERT_TRUE(files.ret);
+    ASSERT_FALSE(files.val.empty());
+
+    double loadMs = 0.0;
+    double layoutMs = 0.0;
+    size_t loaded = 0;
+
+    for (const io::path_t& path : files.val) {
+        MasterScore* score = compat::ScoreAccess::createMasterScoreWithBaseStyle();
+        score->setFileInfoProvider(std::make_shared<LocalFileInfoProvider>(path));
+
+        auto start = std::chrono::steady_clock::now();
+        Ret ret = compat::loadMsczOrMscx(score, path.toString(), true);
+        auto loadEnd = std::chrono::steady_clock::now();
+
+        if (ret) {
+            score->doLayout();
+            auto layoutEnd = std::chrono::steady_clock::now();
+
+            loadMs += std::chrono::duration<double, std::milli>(loadEnd - start).count();
+            layoutMs += std::chrono::duration<double, std::milli>(layoutEnd - loadEnd).count();
+            ++loaded;
+        }
+
+        delete score;
+    }
+
+    std::cout << "loaded and laid out " << loaded << " vtest scores, "
+              << "load: " << loadMs << " ms, layout: " << layoutMs << " ms" << std::endl;
+}
@@ -0,0 +1,82 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2023 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <iostream>
+
+#include "io/dir.h"
+
+#include "engraving/compat/scoreaccess.h"
+#include "engraving/compat/mscxcompat.h"
+#include "engraving/dom/masterscore.h"
+#include "engraving/infrastructure/localfileinfoprovider.h"
+
+#include "utils/scorerw.h"
+
+#include "log.h"
+
+using namespace mu;
+using namespace mu::engraving;
+
+static const String VTEST_SCORES_DIR(u"/../../../vtest/scores");
+
+class Engraving_ReadBenchmarkTests : public ::testing::Test
+{
+};
+
+//! NOTE Measures only reading (without layout) of all vtest scores,
+//! run with --gtest_also_run_disabled_tests --gtest_filter=*ReadBenchmark*
+TEST_F(Engraving_ReadBenchmarkTests, DISABLED_ReadVtestScores)
+{
+    RetVal<io::paths_t> files = io::Dir::scanFiles(ScoreRW::rootPath() + VTEST_SCORES_DIR, { "*.mscz", "*.mscx" },
+                                                   io::ScanMode::FilesInCurrentDir);
+    ASSERT_TRUE(files.ret);
+    ASSERT_FALSE(files.val.empty());
+
+    constexpr int ITERATIONS = 5;
+
+    double totalMs = 0.0;
+    size_t loaded = 0;
+
+    for (int i = 0; i < ITERATIONS; ++i) {
+        for (const io::path_t& path : files.val) {
+            MasterScore* score = compat::ScoreAccess::createMasterScoreWithBaseStyle();
+            score->setFileInfoProvider(std::make_shared<LocalFileInfoProvider>(path));
+
+            auto start = std::chrono::steady_clock::now();
+            Ret ret = compat::loadMsczOrMscx(score, path.toString(), true);
+            auto end = std::chrono::steady_clock::now();
+
+            if (ret) {
+                totalMs += std::chrono::duration<double, std::milli>(end - start).count();
+                ++loaded;
+            }
+
+            delete score;
+        }
+    }
+
+    std::cout << "read " << loaded / ITERATIONS << " vtest scores, "
+              << "total: " << totalMs / ITERATIONS << " ms per pass, "
+              << "average: " << (loaded ? totalMs / loaded : 0.0) << " ms per score" << std::endl;
+}
@@ -0,0 +1,250 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2023 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <cstring>
+#include <iostream>
+#include <random>
+
+#include "io/dir.h"
+
+#include "dom/masterscore.h"
+#include "infrastructure/shape.h"
+
+#include "utils/scorerw.h"
+
+using namespace mu;
+using namespace mu::engraving;
+
+static const String VTEST_SCORES_DIR(u"/../../../vtest/scores");
+
+class Engraving_ShapeTests : public ::testing::Test
+{
+public:
+    //! NOTE The scalar implementations, which the vectorized ones must give the same results as
+    static double referenceMinVerticalDistance(const Shape& top, const Shape& a)
+    {
+        if (top.empty() || a.empty()) {
+            return 0.0;
+        }
+
+        double dist = -1000000.0;
+        for (const RectF& r2 : a.elements()) {
+            if (r2.height() <= 0.0) {
+                continue;
+            }
+            for (const RectF& r1 : top.elements()) {
+                if (r1.height() <= 0.0) {
+                    continue;
+                }
+                if (mu::engraving::intersects(r1.left(), r1.right(), r2.left(), r2.right(), 0.0)) {
+                    dist = std::max(dist, r1.bottom() - r2.top());
+                }
+            }
+        }
+        return dist;
+    }
+
+    static double referenceVerticalClearance(const Shape& top, const Shape& a, double minHorizontalDistance)
+    {
+        if (top.empty() || a.empty()) {
+            return 0.0;
+        }
+
+        double dist = 1000000.0;
+        for (const RectF& r2 : a.elements()) {
+            if (r2.height() <= 0.0) {
+                continue;
+            }
+            double bx1 = r2.left() - minHorizontalDistance;
+            double bx2 = r2.right() + minHorizontalDistance;
+            for (const RectF& r1 : top.elements()) {
+                if (r1.height() <= 0.0) {
+                    continue;
+                }
+                if (mu::engraving::intersects(r1.left(), r1.right(), bx1, bx2, 0.0)) {
+                    dist = std::min(dist, r2.top() - r1.bottom());
+                }
+            }
+        }
+        return dist;
+    }
+
+    static Shape randomShape(std::mt19937& rng, size_t size, double y)
+    {
+        std::uniform_real_distribution<double> pos(0.0, 200.0);
+        std::uniform_real_distribution<double> extent(0.0, 10.0);
+
+        Shape shape(Shape::Type::Composite);
+        for (size_t i = 0; i < size; ++i) {
+            double w = rng() % 8 == 0 ? 0.0 : extent(rng);
+            double h = rng() % 8 == 0 ? 0.0 : extent(rng);
+            shape.add(RectF(pos(rng), y + pos(rng) / 10, w, h));
+        }
+        return shape;
+    }
+
+    static bool bitwiseEqual(double a, double b)
+    {
+        return std::memcmp(&a, &b, sizeof(double)) == 0;
+    }
+};
+
+TEST_F(Engraving_ShapeTests, VerticalDistancesEqualToScalar)
+{
+    std::mt19937 rng(42);
+
+    for (int i = 0; i < 2000; ++i) {
+        //! [GIVEN] Two random shapes of different sizes, including zero width and zero height rects
+        Shape top = randomShape(rng, rng() % 40, 0.0);
+        Shape bottom = randomShape(rng, rng() % 40, 10.0);
+
+        //! [THEN] The distances are exactly the same as the scalar ones
+        EXPECT_TRUE(bitwiseEqual(top.minVerticalDistance(bottom), referenceMinVerticalDistance(top, bottom)));
+        EXPECT_TRUE(bitwiseEqual(top.verticalClearance(bottom), referenceVerticalClearance(top, bottom, 0.0)));
+        EXPECT_TRUE(bitwiseEqual(top.verticalClearance(bottom, 1.5), referenceVerticalClearance(top, bottom, 1.5)));
+    }
+}
+
+TEST_F(Engraving_ShapeTests, AddTranslated)
+{
+    std::mt19937 rng(42);
+
+    //! [GIVEN] A shape and an offset
+    Shape shape = randomShape(rng, 10, 0.0);
+    PointF offset(12.5, -3.25);
+
+    //! [WHEN] Adding the shape translated by the offset
+    Shape added(Shape::Type::Composite);
+    added.add(shape, offset);
+
+    //! [THEN] The result is the same as adding a translated copy
+    Shape expected(Shape::Type::Composite);
+    expected.add(Shape(shape).translate(offset));
+    EXPECT_TRUE(added.equal(expected));
+    EXPECT_EQ(added.bbox(), expected.bbox());
+}
+
+TEST_F(Engraving_ShapeTests, ScratchShapeNesting)
+{
+    const Shape* outerPtr = nullptr;
+    {
+        //! [GIVEN] A scratch shape in use
+        ScratchShape outer;
+        outer->add(RectF(0.0, 0.0, 10.0, 10.0));
+        outerPtr = &(*outer);
+
+        //! [WHEN] Another one is taken while the first one is alive
+        {
+            ScratchShape inner;
+
+            //! [THEN] It is a different, empty, composite shape
+            EXPECT_NE(&(*inner), outerPtr);
+            EXPECT_TRUE(inner->empty());
+            EXPECT_TRUE(inner->isComposite());
+            inner->add(RectF(20.0, 0.0, 5.0, 5.0));
+        }
+
+        EXPECT_EQ(outer->size(), 1u);
+        EXPECT_EQ(outer->bbox(), RectF(0.0, 0.0, 10.0, 10.0));
+    }
+
+    //! [THEN] Released shapes are reused and come back cleared
+    ScratchShape again;
+    EXPECT_EQ(&(*again), outerPtr);
+    EXPECT_TRUE(again->empty());
+    EXPECT_FALSE(again->bbox().isValid());
+}
+
+//! NOTE Benchmarks, run with --gtest_also_run_disabled_tests --gtest_filter=*ShapeTests*
+TEST_F(Engraving_ShapeTests, DISABLED_VerticalDistancesBenchmark)
+{
+    using Clock = std::chrono::steady_clock;
+
+    std::mt19937 rng(42);
+
+    for (size_t size : { 4, 16, 64, 256 }) {
+        std::vector<std::pair<Shape, Shape> > shapes;
+        for (int i = 0; i < 100; ++i) {
+            shapes.emplace_back(randomShape(rng, size, 0.0), randomShape(rng, size, 10.0));
+        }
+
+        constexpr int ITERATIONS = 100;
+        double checksum = 0.0;
+
+        auto start = Clock::now();
+        for (int i = 0; i < ITERATIONS; ++i) {
+            for (const auto& pair : shapes) {
+                checksum += pair.first.minVerticalDistance(pair.second);
+                checksum += pair.first.verticalClearance(pair.second);
+            }
+        }
+        auto kernelTime = Clock::now() - start;
+
+        start = Clock::now();
+        for (int i = 0; i < ITERATIONS; ++i) {
+            for (const auto& pair : shapes) {
+                checksum -= referenceMinVerticalDistance(pair.first, pair.second);
+                checksum -= referenceVerticalClearance(pair.first, pair.second, 0.0);
+            }
+        }
+        auto scalarTime = Clock::now() - start;
+
+        std::cout << "shape size " << size
+                  << ", kernel: " << std::chrono::duration<double, std::milli>(kernelTime).count() << " ms"
+                  << ", scalar: " << std::chrono::duration<double, std::milli>(scalarTime).count() << " ms"
+                  << " (" << checksum << ")" << std::endl;
+    }
+}
+
+TEST_F(Engraving_ShapeTests, DISABLED_LayoutBenchmark)
+{
+    RetVal<io::paths_t> files = io::Dir::scanFiles(ScoreRW::rootPath() + VTEST_SCORES_DIR, { "*.mscz", "*.mscx" },
+                                                   io::ScanMode::FilesInCurrentDir);
+    ASSERT_TRUE(files.ret);
+
+    constexpr int ITERATIONS = 3;
+
+    double totalMs = 0.0;
+    size_t laidOut = 0;
+
+    for (const io::path_t& path : files.val) {
+        MasterScore* score = ScoreRW::readScore(path.toString(), true);
+        if (!score) {
+            continue;
+        }
+
+        for (int i = 0; i < ITERATIONS; ++i) {
+            auto start = std::chrono::steady_clock::now();
+            score->doLayout();
+            totalMs += std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+        }
+
+        ++laidOut;
+        delete score;
+    }
+
+    std::cout << "laid out " << laidOut << " vtest scores, "
+              << "total: " << totalMs / ITERATIONS << " ms per pass" << std::endl;
+}
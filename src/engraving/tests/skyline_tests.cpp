@@ -0,0 +1,221 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2023 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <cstring>
+#include <iostream>
+#include <random>
+
+#include "infrastructure/skyline.h"
+
+using namespace mu;
+using namespace mu::engraving;
+
+class Engraving_SkylineTests : public ::testing::Test
+{
+public:
+    //! NOTE The linear merge, which the minimum distance must give the same results as
+    static double referenceMinDistance(const SkylineLine& top, const SkylineLine& sl)
+    {
+        double dist = -1000000.0;
+
+        double x1 = 0.0;
+        double x2 = 0.0;
+        auto k = sl.begin();
+        for (auto i = top.begin(); i != top.end(); ++i) {
+            while (k != sl.end() && (x2 + k->w) < x1) {
+                x2 += k->w;
+                ++k;
+            }
+            if (k == sl.end()) {
+                break;
+            }
+            for (;;) {
+                if ((x1 + i->w > x2) && (x1 < x2 + k->w)) {
+                    dist = std::max(dist, i->y - k->y);
+                }
+                if (x2 + k->w < x1 + i->w) {
+                    x2 += k->w;
+                    ++k;
+                    if (k == sl.end()) {
+                        break;
+                    }
+                } else {
+                    break;
+                }
+            }
+            if (k == sl.end()) {
+                break;
+            }
+            x1 += i->w;
+        }
+        return dist;
+    }
+
+    static RectF randomRect(std::mt19937& rng, double width, double y)
+    {
+        std::uniform_real_distribution<double> pos(0.0, width);
+        std::uniform_real_distribution<double> extent(0.0, 20.0);
+        return RectF(pos(rng), y + pos(rng) / 50, extent(rng), extent(rng));
+    }
+
+    static void fillSkyline(Skyline& skyline, std::mt19937& rng, size_t rects, double width)
+    {
+        for (size_t i = 0; i < rects; ++i) {
+            skyline.add(randomRect(rng, width, 0.0));
+        }
+    }
+
+    static bool bitwiseEqual(double a, double b)
+    {
+        return std::memcmp(&a, &b, sizeof(double)) == 0;
+    }
+};
+
+TEST_F(Engraving_SkylineTests, MinDistanceEqualToMerge)
+{
+    std::mt19937 rng(42);
+
+    for (int i = 0; i < 200; ++i) {
+        //! [GIVEN] Two skylines of random rects
+        Skyline top;
+        Skyline bottom;
+        fillSkyline(top, rng, rng() % 200, 1000.0);
+        fillSkyline(bottom, rng, rng() % 200, 1000.0);
+
+        //! [THEN] The distance is exactly the same as by the linear merge
+        EXPECT_TRUE(bitwiseEqual(top.minDistance(bottom), referenceMinDistance(top.south(), bottom.north())));
+        EXPECT_TRUE(bitwiseEqual(bottom.north().minDistance(top.south()), referenceMinDistance(bottom.north(), top.south())));
+    }
+}
+
+TEST_F(Engraving_SkylineTests, MinDistanceWhileAdding)
+{
+    std::mt19937 rng(42);
+
+    //! [GIVEN] A skyline, to which the rects of the autoplaced items are added one by one
+    Skyline skyline;
+    fillSkyline(skyline, rng, 100, 1000.0);
+
+    for (int i = 0; i < 500; ++i) {
+        RectF r = randomRect(rng, 1000.0, -50.0);
+
+        //! [WHEN] Querying the distance of an item above and of one below the staff
+        SkylineLine above(false);
+        above.add(r.x(), r.bottom(), r.width());
+
+        RectF r2 = r.translated(0.0, 100.0);
+        SkylineLine below(true);
+        below.add(r2.x(), r2.top(), r2.width());
+
+        //! [THEN] The cache of the skyline is up to date
+        EXPECT_TRUE(bitwiseEqual(above.minDistance(skyline.north()), referenceMinDistance(above, skyline.north())));
+        EXPECT_TRUE(bitwiseEqual(skyline.south().minDistance(below), referenceMinDistance(skyline.south(), below)));
+
+        skyline.add(r);
+        skyline.add(r2);
+    }
+}
+
+TEST_F(Engraving_SkylineTests, StaffDistanceWhileAdding)
+{
+    std::mt19937 rng(42);
+
+    //! [GIVEN] The skylines of two staves, which get the rects of the segments added one by one
+    Skyline top;
+    Skyline bottom;
+
+    for (int i = 0; i < 500; ++i) {
+        top.add(randomRect(rng, 1000.0, 0.0));
+        bottom.add(randomRect(rng, 1000.0, 0.0));
+
+        //! [THEN] The distance between the staves is the same as by the linear merge
+        EXPECT_TRUE(bitwiseEqual(top.minDistance(bottom), referenceMinDistance(top.south(), bottom.north())));
+    }
+}
+
+//! NOTE Benchmark, run with --gtest_also_run_disabled_tests --gtest_filter=*SkylineTests*
+TEST_F(Engraving_SkylineTests, DISABLED_SystemDistanceBenchmark)
+{
+    using Clock = std::chrono::steady_clock;
+
+    constexpr size_t STAVES = 40;
+    constexpr size_t RECTS_PER_STAFF = 2000;
+    constexpr size_t AUTOPLACE_QUERIES = 200;
+    constexpr double SYSTEM_WIDTH = 5000.0;
+    constexpr int ITERATIONS = 20;
+
+    std::mt19937 rng(42);
+
+    //! [GIVEN] A system of 40 staves with full skylines
+    std::vector<Skyline> staves(STAVES);
+    for (Skyline& skyline : staves) {
+        fillSkyline(skyline, rng, RECTS_PER_STAFF, SYSTEM_WIDTH);
+    }
+
+    std::vector<RectF> items;
+    for (size_t i = 0; i < AUTOPLACE_QUERIES; ++i) {
+        items.push_back(randomRect(rng, SYSTEM_WIDTH, -50.0));
+    }
+
+    double checksum = 0.0;
+
+    //! [WHEN] The distances between the staves and of the autoplaced items are computed
+    auto staffDistances = [&](auto minDistance) {
+        auto start = Clock::now();
+        for (int i = 0; i < ITERATIONS; ++i) {
+            for (size_t si = 0; si + 1 < STAVES; ++si) {
+                checksum += minDistance(staves[si].south(), staves[si + 1].north());
+            }
+        }
+        return std::chrono::duration<double, std::milli>(Clock::now() - start).count() / ITERATIONS;
+    };
+
+    auto autoplaceDistances = [&](auto minDistance) {
+        auto start = Clock::now();
+        for (int i = 0; i < ITERATIONS; ++i) {
+            for (const Skyline& skyline : staves) {
+                for (const RectF& r : items) {
+                    SkylineLine sk(false);
+                    sk.add(r.x(), r.bottom(), r.width());
+                    checksum += minDistance(sk, skyline.north());
+                }
+            }
+        }
+        return std::chrono::duration<double, std::milli>(Clock::now() - start).count() / ITERATIONS;
+    };
+
+    auto skylineDistance = [](const SkylineLine& top, const SkylineLine& sl) { return top.minDistance(sl); };
+    auto mergeDistance = [](const SkylineLine& top, const SkylineLine& sl) { return -referenceMinDistance(top, sl); };
+
+    double staffTime = staffDistances(skylineDistance);
+    double staffReferenceTime = staffDistances(mergeDistance);
+    double autoplaceTime = autoplaceDistances(skylineDistance);
+    double autoplaceReferenceTime = autoplaceDistances(mergeDistance);
+
+    std::cout << STAVES << " staves, per system, "
+              << "staff distances: " << staffTime << " ms (linear merge: " << staffReferenceTime << " ms), "
+              << "autoplace: " << autoplaceTime << " ms (linear merge: " << autoplaceReferenceTime << " ms)"
+              << " (" << checksum << ")" << std::endl;
+}
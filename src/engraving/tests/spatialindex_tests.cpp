@@ -0,0 +1,238 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2023 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <chrono>
+
+#include "io/dir.h"
+
+#include "dom/masterscore.h"
+#include "dom/page.h"
+#include "dom/system.h"
+
+#include "utils/scorerw.h"
+
+#include "log.h"
+
+using namespace mu;
+using namespace mu::engraving;
+
+static const String ALL_ELEMENTS_DATA_DIR("all_elements_data/");
+static const String VTEST_SCORES_DIR(u"/../../../vtest/scores");
+
+class Engraving_SpatialIndexTests : public ::testing::Test
+{
+public:
+    static std::vector<EngravingItem*> pageItems(Page* page)
+    {
+        std::vector<EngravingItem*> items;
+        page->scanElements(&items, [](void* data, EngravingItem* e) {
+            static_cast<std::vector<EngravingItem*>*>(data)->push_back(e);
+        }, false);
+
+        return items;
+    }
+
+    static std::vector<EngravingItem*> sorted(std::vector<EngravingItem*> items)
+    {
+        std::sort(items.begin(), items.end());
+        return items;
+    }
+
+    static std::vector<EngravingItem*> bruteForceItems(const std::vector<EngravingItem*>& all, const RectF& rect)
+    {
+        std::vector<EngravingItem*> result;
+        for (EngravingItem* e : all) {
+            if (e->pageBoundingRect().intersects(rect)) {
+                result.push_back(e);
+            }
+        }
+
+        return sorted(result);
+    }
+
+    //! NOTE The shape of an item may stick out of its bounding rect a bit, and then
+    //! it depends on the index whether the item is found there, so only the items
+    //! which contain the point within their bounding rects must be found
+    static void checkItems(const std::vector<EngravingItem*>& all, const PointF& pos, const std::vector<EngravingItem*>& found)
+    {
+        for (EngravingItem* e : found) {
+            EXPECT_TRUE(e->contains(pos));
+        }
+
+        for (EngravingItem* e : all) {
+            RectF r = e->pageBoundingRect().normalized();
+            bool inRect = pos.x() >= r.left() && pos.x() <= r.right() && pos.y() >= r.top() && pos.y() <= r.bottom();
+
+            if (inRect && e->contains(pos)) {
+                EXPECT_TRUE(std::find(found.begin(), found.end(), e) != found.end());
+            }
+        }
+    }
+
+    static void checkPage(Page* page)
+    {
+        const std::vector<EngravingItem*> all = pageItems(page);
+        const RectF bbox = page->ldata()->bbox();
+
+        constexpr int STEPS = 24;
+        const double dx = bbox.width() / STEPS;
+        const double dy = bbox.height() / STEPS;
+
+        for (int i = 0; i <= STEPS; ++i) {
+            for (int j = 0; j <= STEPS; ++j) {
+                PointF pos(bbox.left() + i * dx, bbox.top() + j * dy);
+                checkItems(all, pos, page->items(pos));
+
+                RectF rect(pos.x(), pos.y(), dx * 3.5, dy * 1.5);
+                EXPECT_EQ(sorted(page->items(rect)), bruteForceItems(all, rect));
+            }
+        }
+
+        // the whole page and beyond
+        RectF outer = bbox.adjusted(-100.0, -100.0, 100.0, 100.0);
+        EXPECT_EQ(sorted(page->items(outer)), bruteForceItems(all, outer));
+    }
+};
+
+TEST_F(Engraving_SpatialIndexTests, ItemsEqualToBruteForce)
+{
+    MasterScore* score = ScoreRW::readScore(ALL_ELEMENTS_DATA_DIR + u"layout_elements.mscx");
+    ASSERT_TRUE(score);
+    ASSERT_FALSE(score->pages().empty());
+
+    for (Page* page : score->pages()) {
+        checkPage(page);
+    }
+
+    delete score;
+}
+
+TEST_F(Engraving_SpatialIndexTests, SystemUpdate)
+{
+    MasterScore* score = ScoreRW::readScore(ALL_ELEMENTS_DATA_DIR + u"moonlight.mscx");
+    ASSERT_TRUE(score);
+    ASSERT_FALSE(score->pages().empty());
+
+    Page* page = score->pages().front();
+    ASSERT_FALSE(page->systems().empty());
+
+    //! [GIVEN] The index of the page is built
+    checkPage(page);
+
+    //! [WHEN] The systems are indexed again one by one
+    for (System* system : page->systems()) {
+        page->invalidateSpatialIndex(system);
+
+        //! [THEN] The found items are still the same
+        checkPage(page);
+    }
+
+    delete score;
+}
+
+//! NOTE Measures the queries on all vtest scores against the linear search,
+//! run with --gtest_also_run_disabled_tests --gtest_filter=*SpatialIndex*
+TEST_F(Engraving_SpatialIndexTests, DISABLED_ItemsBenchmark)
+{
+    using Clock = std::chrono::steady_clock;
+
+    RetVal<io::paths_t> files = io::Dir::scanFiles(ScoreRW::rootPath() + VTEST_SCORES_DIR, { "*.mscz", "*.mscx" },
+                                                   io::ScanMode::FilesInCurrentDir);
+    ASSERT_TRUE(files.ret);
+
+    // the densest pages tell the most
+    constexpr size_t MIN_PAGE_ITEMS = 1000;
+    constexpr int STEPS = 64;
+
+    size_t pageCount = 0;
+    size_t itemCount = 0;
+    size_t queryCount = 0;
+    size_t found = 0;
+    Clock::duration buildTime = Clock::duration::zero();
+    Clock::duration rectTime = Clock::duration::zero();
+    Clock::duration pointTime = Clock::duration::zero();
+    Clock::duration linearRectTime = Clock::duration::zero();
+
+    for (const io::path_t& path : files.val) {
+        MasterScore* score = ScoreRW::readScore(path.toString(), true);
+        if (!score) {
+            continue;
+        }
+
+        for (Page* page : score->pages()) {
+            const std::vector<EngravingItem*> all = pageItems(page);
+            if (all.size() < MIN_PAGE_ITEMS) {
+                continue;
+            }
+
+            ++pageCount;
+            itemCount += all.size();
+
+            const RectF bbox = page->ldata()->bbox();
+            const double dx = bbox.width() / STEPS;
+            const double dy = bbox.height() / STEPS;
+
+            auto start = Clock::now();
+            page->invalidateSpatialIndex();
+            page->items(PointF());
+            buildTime += Clock::now() - start;
+
+            for (int i = 0; i < STEPS; ++i) {
+                for (int j = 0; j < STEPS; ++j) {
+                    PointF pos(bbox.left() + i * dx, bbox.top() + j * dy);
+                    RectF rect(pos.x(), pos.y(), bbox.width() / 4, bbox.height() / 4);
+
+                    start = Clock::now();
+                    found += page->items(rect).size();
+                    rectTime += Clock::now() - start;
+
+                    start = Clock::now();
+                    found += page->items(pos).size();
+                    pointTime += Clock::now() - start;
+
+                    start = Clock::now();
+                    for (EngravingItem* e : all) {
+                        found += e->pageBoundingRect().intersects(rect);
+                    }
+                    linearRectTime += Clock::now() - start;
+
+                    ++queryCount;
+                }
+            }
+        }
+
+        delete score;
+    }
+
+    auto us = [queryCount](Clock::duration d) {
+        return queryCount ? std::chrono::duration<double, std::micro>(d).count() / queryCount : 0.0;
+    };
+
+    std::cout << "pages: " << pageCount << ", items per page: " << (pageCount ? itemCount / pageCount : 0)
+              << ", build: " << std::chrono::duration<double, std::milli>(buildTime).count() / std::max(pageCount, size_t(1))
+              << " ms per page" << std::endl
+              << "items(rect): " << us(rectTime) << " us, items(point): " << us(pointTime) << " us, "
+              << "linear items(rect): " << us(linearRectTime) << " us per query (" << found << ")" << std::endl;
+}
@@ -0,0 +1,77 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2023 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include <gtest/gtest.h>
+
+#include "engraving/style/defaultstyle.h"
+#include "engraving/style/style.h"
+
+using namespace mu;
+using namespace mu::engraving;
+
+class Engraving_StyleTests : public ::testing::Test
+{
+};
+
+static void checkResolvedValues(const MStyle& style)
+{
+    for (int i = 0; i < static_cast<int>(Sid::STYLES); ++i) {
+        Sid sid = static_cast<Sid>(i);
+        const MStyle::ResolvedValue& resolved = style.resolvedValue(sid);
+
+        switch (MStyle::valueType(sid)) {
+        case P_TYPE::SPATIUM:
+            EXPECT_DOUBLE_EQ(resolved.real, style.styleS(sid).val()) << MStyle::valueName(sid);
+            EXPECT_DOUBLE_EQ(resolved.mm, style.styleS(sid).val() * style.spatium()) << MStyle::valueName(sid);
+            break;
+        case P_TYPE::REAL:
+            EXPECT_DOUBLE_EQ(resolved.real, style.styleD(sid)) << MStyle::valueName(sid);
+            break;
+        case P_TYPE::BOOL:
+            EXPECT_EQ(resolved.integer != 0, style.styleB(sid)) << MStyle::valueName(sid);
+            break;
+        case P_TYPE::INT:
+            EXPECT_EQ(resolved.integer, style.styleI(sid)) << MStyle::valueName(sid);
+            break;
+        default:
+            break;
+        }
+    }
+}
+
+TEST_F(Engraving_StyleTests, ResolvedValues)
+{
+    MStyle style = DefaultStyle::defaultStyle();
+    checkResolvedValues(style);
+
+    //! NOTE spatium change rescales all spatium values
+    style.setSpatium(style.spatium() * 2);
+    checkResolvedValues(style);
+
+    style.set(Sid::stemWidth, Spatium(0.5));
+    style.set(Sid::beamNoSlope, true);
+    style.set(Sid::minEmptyMeasures, 5);
+    checkResolvedValues(style);
+
+    EXPECT_DOUBLE_EQ(style.resolvedValue(Sid::stemWidth).real, 0.5);
+    EXPECT_EQ(style.resolvedValue(Sid::beamNoSlope).integer, 1);
+    EXPECT_EQ(style.resolvedValue(Sid::minEmptyMeasures).integer, 5);
+}
@@ -0,0 +1,297 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2023 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <gtest/gtest.h>
+
+#include "dom/chord.h"
+#include "dom/masterscore.h"
+#include "dom/measure.h"
+#include "dom/note.h"
+#include "dom/undo.h"
+
+#include "utils/scorerw.h"
+
+using namespace mu;
+using namespace mu::engraving;
+
+static const String UNDOSTACK_DATA_DIR("undostack_data/");
+
+static const mu::draw::Color COLORS[] = {
+    mu::draw::Color(255, 0, 0),
+    mu::draw::Color(0, 255, 0),
+    mu::draw::Color(0, 0, 255),
+    mu::draw::Color(255, 255, 0),
+};
+
+class Engraving_UndoStackTests : public ::testing::Test
+{
+public:
+    static Note* firstNote(MasterScore* score)
+    {
+        Chord* chord = score->firstMeasure()->findChord(Fraction(0, 1), 0);
+        return chord ? chord->upNote() : nullptr;
+    }
+
+    static size_t changePropertyCount(const UndoMacro* macro, const EngravingObject* element, Pid pid)
+    {
+        size_t count = 0;
+        for (const UndoCommand* cmd : macro->commands()) {
+            if (cmd->type() == CommandType::ChangeProperty) {
+                const ChangeProperty* cp = static_cast<const ChangeProperty*>(cmd);
+                if (cp->getElement() == element && cp->getId() == pid) {
+                    ++count;
+                }
+            }
+        }
+        return count;
+    }
+
+    static void changeColor(MasterScore* score, Note* note, const mu::draw::Color& color)
+    {
+        score->startCmd();
+        note->undoChangeProperty(Pid::COLOR, PropertyValue::fromValue(color));
+        score->endCmd();
+    }
+};
+
+TEST_F(Engraving_UndoStackTests, ChangePropertyMerged)
+{
+    MasterScore* score = ScoreRW::readScore(UNDOSTACK_DATA_DIR + u"undostack.mscx");
+    ASSERT_TRUE(score);
+
+    Note* note = firstNote(score);
+    ASSERT_TRUE(note);
+
+    const mu::draw::Color color = note->color();
+
+    //! [GIVEN] The same property is changed several times in one command
+    score->startCmd();
+    note->undoChangeProperty(Pid::COLOR, PropertyValue::fromValue(COLORS[0]));
+    note->undoChangeProperty(Pid::COLOR, PropertyValue::fromValue(COLORS[1]));
+    note->undoChangeProperty(Pid::COLOR, PropertyValue::fromValue(COLORS[2]));
+    score->endCmd();
+
+    //! [THEN] Only the first change is kept
+    UndoMacro* macro = score->undoStack()->last();
+    ASSERT_TRUE(macro);
+    EXPECT_EQ(changePropertyCount(macro, note, Pid::COLOR), 1);
+    EXPECT_EQ(note->color(), COLORS[2]);
+
+    //! [THEN] Undo and redo restore the values from before and after all changes
+    score->undoStack()->undo(nullptr);
+    EXPECT_EQ(note->color(), color);
+
+    score->undoStack()->redo(nullptr);
+    EXPECT_EQ(note->color(), COLORS[2]);
+
+    //! [GIVEN] Changes of the property are not consecutive
+    score->startCmd();
+    note->undoChangeProperty(Pid::COLOR, PropertyValue::fromValue(COLORS[0]));
+    note->undoChangeProperty(Pid::VISIBLE, false);
+    note->undoChangeProperty(Pid::COLOR, PropertyValue::fromValue(COLORS[1]));
+    score->endCmd();
+
+    //! [THEN] They are not merged
+    macro = score->undoStack()->last();
+    ASSERT_TRUE(macro);
+    EXPECT_EQ(changePropertyCount(macro, note, Pid::COLOR), 2);
+
+    score->undoStack()->undo(nullptr);
+    EXPECT_EQ(note->color(), COLORS[2]);
+    EXPECT_TRUE(note->visible());
+
+    delete score;
+}
+
+TEST_F(Engraving_UndoStackTests, MaxStepsDiscardOldest)
+{
+    MasterScore* score = ScoreRW::readScore(UNDOSTACK_DATA_DIR + u"undostack.mscx");
+    ASSERT_TRUE(score);
+
+    Note* note = firstNote(score);
+    ASSERT_TRUE(note);
+
+    UndoStack* undoStack = score->undoStack();
+    undoStack->setLimits(2, 0);
+
+    changeColor(score, note, COLORS[0]);
+    const size_t startIdx = undoStack->getCurIdx();
+
+    for (size_t i = 1; i < std::size(COLORS); ++i) {
+        changeColor(score, note, COLORS[i]);
+    }
+
+    //! [THEN] Only the last two steps are kept, the index counts the discarded ones
+    EXPECT_EQ(undoStack->discardedCount(), 2);
+    EXPECT_EQ(undoStack->getCurIdx(), std::size(COLORS));
+
+    //! [WHEN] Steps are merged from an index of a discarded step
+    undoStack->mergeCommands(startIdx);
+
+    //! [THEN] The kept steps are merged into one
+    undoStack->undo(nullptr);
+    EXPECT_EQ(note->color(), COLORS[1]);
+    EXPECT_FALSE(undoStack->canUndo());
+
+    undoStack->redo(nullptr);
+    EXPECT_EQ(note->color(), COLORS[3]);
+
+    delete score;
+}
+
+TEST_F(Engraving_UndoStackTests, LowerLimitsAppliedAtOnce)
+{
+    MasterScore* score = ScoreRW::readScore(UNDOSTACK_DATA_DIR + u"undostack.mscx");
+    ASSERT_TRUE(score);
+
+    Note* note = firstNote(score);
+    ASSERT_TRUE(note);
+
+    UndoStack* undoStack = score->undoStack();
+    undoStack->setLimits(0, 0);
+
+    for (const mu::draw::Color& color : COLORS) {
+        changeColor(score, note, color);
+    }
+    EXPECT_EQ(undoStack->discardedCount(), 0);
+
+    //! [WHEN] The limits are lowered outside of a command
+    undoStack->setLimits(2, 0);
+
+    //! [THEN] The oldest steps are discarded without waiting for the next command
+    EXPECT_EQ(undoStack->discardedCount(), 2);
+
+    undoStack->undo(nullptr);
+    undoStack->undo(nullptr);
+    EXPECT_EQ(note->color(), COLORS[1]);
+    EXPECT_FALSE(undoStack->canUndo());
+
+    delete score;
+}
+
+TEST_F(Engraving_UndoStackTests, MemoryUsage)
+{
+    const size_t totalBefore = UndoStack::statistic().memoryUsage;
+
+    MasterScore* score = ScoreRW::readScore(UNDOSTACK_DATA_DIR + u"undostack.mscx");
+    ASSERT_TRUE(score);
+
+    Note* note = firstNote(score);
+    ASSERT_TRUE(note);
+
+    UndoStack* undoStack = score->undoStack();
+    const size_t usageBefore = undoStack->memoryUsage();
+
+    changeColor(score, note, COLORS[0]);
+    const size_t stepSize = undoStack->memoryUsage() - usageBefore;
+    EXPECT_GT(stepSize, 0);
+    EXPECT_EQ(UndoStack::statistic().memoryUsage, totalBefore + undoStack->memoryUsage());
+
+    //! [GIVEN] The memory limit allows about two steps of the same size
+    const size_t maxMemory = stepSize * 5 / 2;
+    undoStack->setLimits(0, maxMemory);
+
+    for (size_t i = 1; i < std::size(COLORS); ++i) {
+        changeColor(score, note, COLORS[i]);
+    }
+
+    //! [THEN] The oldest steps are discarded
+    EXPECT_LE(undoStack->memoryUsage(), maxMemory);
+    EXPECT_GT(undoStack->discardedCount(), 0);
+    EXPECT_TRUE(undoStack->canUndo());
+
+    //! [THEN] The cleared redo stack is not accounted anymore
+    undoStack->undo(nullptr);
+    changeColor(score, note, COLORS[0]);
+    EXPECT_LE(undoStack->memoryUsage(), maxMemory);
+    EXPECT_EQ(UndoStack::statistic().memoryUsage, totalBefore + undoStack->memoryUsage());
+
+    delete score;
+
+    EXPECT_EQ(UndoStack::statistic().memoryUsage, totalBefore);
+}
+
+TEST_F(Engraving_UndoStackTests, DiscardRemovedElements)
+{
+    MasterScore* score = ScoreRW::readScore(UNDOSTACK_DATA_DIR + u"undostack.mscx");
+    ASSERT_TRUE(score);
+
+    UndoStack* undoStack = score->undoStack();
+
+    //! [GIVEN] A memory limit that every step exceeds, so only the last step is kept
+    undoStack->setLimits(0, 1);
+
+    //! [WHEN] Chords are removed, then the last measure, then the steps are discarded
+    Measure* m1 = score->firstMeasure();
+    Measure* m2 = m1->nextMeasure();
+    Measure* m3 = m2->nextMeasure();
+    Measure* m4 = m3->nextMeasure();
+
+    score->startCmd();
+    score->deleteItem(m1->findChord(m1->tick(), 0));
+    score->endCmd();
+
+    score->startCmd();
+    score->deleteItem(m2->findChord(m2->tick(), 0)->upNote());
+    score->endCmd();
+
+    score->startCmd();
+    score->deleteMeasures(m4, m4);
+    score->endCmd();
+
+    //! [THEN] The removed measure is accounted while its step is kept
+    EXPECT_GT(undoStack->memoryUsage(), sizeof(Measure));
+
+    //! NOTE Discarding the measure removal deletes the measure, run under ASan to check it
+    Note* note = m3->findChord(m3->tick(), 0)->upNote();
+    changeColor(score, note, COLORS[0]);
+
+    EXPECT_EQ(undoStack->discardedCount(), 3);
+    EXPECT_EQ(score->nmeasures(), 3);
+
+    //! [THEN] The kept step is undone and redone, the discarded ones stay done
+    undoStack->undo(nullptr);
+    EXPECT_NE(note->color(), COLORS[0]);
+    EXPECT_FALSE(undoStack->canUndo());
+
+    undoStack->redo(nullptr);
+    EXPECT_EQ(note->color(), COLORS[0]);
+    EXPECT_FALSE(m1->findChord(m1->tick(), 0));
+    EXPECT_FALSE(m2->findChord(m2->tick(), 0));
+
+    //! [WHEN] Editing continues after the discarded steps
+    score->startCmd();
+    score->deleteItem(m3->findChord(m3->tick() + Fraction(1, 4), 0));
+    score->endCmd();
+    EXPECT_FALSE(m3->findChord(m3->tick() + Fraction(1, 4), 0));
+
+    //! [THEN] The new steps are undone and redone as usual
+    undoStack->undo(nullptr);
+    EXPECT_TRUE(m3->findChord(m3->tick() + Fraction(1, 4), 0));
+    EXPECT_EQ(note->color(), COLORS[0]);
+    EXPECT_FALSE(undoStack->canUndo());
+
+    undoStack->redo(nullptr);
+    EXPECT_FALSE(m3->findChord(m3->tick() + Fraction(1, 4), 0));
+
+    delete score;
+}
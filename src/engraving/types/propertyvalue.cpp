@@ -69,17 +69,17 @@ bool PropertyValue::operator ==(const PropertyValue& v) const
         return RealIsEqual(v.value<double>(), value<double>());
     }
 
-    assert(m_data);
-    if (!m_data) {
+    assert(m_ops);
+    if (!m_ops) {
         return false;
     }
 
-    assert(v.m_data);
-    if (!v.m_data) {
+    assert(v.m_ops);
+    if (!v.m_ops) {
         return false;
     }
 
-    return v.m_type == m_type && v.m_data->equal(m_data.get());
+    return v.m_type == m_type && m_ops->equal(m_storage, v.m_storage);
 }
 
 #ifndef NO_QT_SUPPORT
@@ -26,6 +26,10 @@
 #include <string>
 #include <memory>
 #include <cassert>
+#include <cstring>
+#include <cstddef>
+#include <new>
+#include <type_traits>
 
 #include "types/string.h"
 #include "types/types.h"
@@ -111,178 +115,278 @@ enum class P_TYPE {
     GROUPS,
 };
 
+//! NOTE The type stored in PropertyValue for each P_TYPE,
+//! used to check the stored value without RTTI
+template<typename T>
+struct PropertyTypeOf {
+    static constexpr P_TYPE value = P_TYPE::UNDEFINED;
+};
+
+#define DECLARE_PROPERTY_TYPE(T, TYPE) \
+    template<> \
+    struct PropertyTypeOf<T> { \
+        static constexpr P_TYPE value = TYPE; \
+    };
+
+DECLARE_PROPERTY_TYPE(bool, P_TYPE::BOOL)
+DECLARE_PROPERTY_TYPE(int, P_TYPE::INT)
+DECLARE_PROPERTY_TYPE(std::vector<int>, P_TYPE::INT_VEC)
+DECLARE_PROPERTY_TYPE(size_t, P_TYPE::SIZE_T)
+DECLARE_PROPERTY_TYPE(double, P_TYPE::REAL)
+DECLARE_PROPERTY_TYPE(String, P_TYPE::STRING)
+DECLARE_PROPERTY_TYPE(PointF, P_TYPE::POINT)
+DECLARE_PROPERTY_TYPE(SizeF, P_TYPE::SIZE)
+DECLARE_PROPERTY_TYPE(PainterPath, P_TYPE::DRAW_PATH)
+DECLARE_PROPERTY_TYPE(ScaleF, P_TYPE::SCALE)
+DECLARE_PROPERTY_TYPE(Spatium, P_TYPE::SPATIUM)
+DECLARE_PROPERTY_TYPE(Millimetre, P_TYPE::MILLIMETRE)
+DECLARE_PROPERTY_TYPE(PairF, P_TYPE::PAIR_REAL)
+DECLARE_PROPERTY_TYPE(SymId, P_TYPE::SYMID)
+DECLARE_PROPERTY_TYPE(Color, P_TYPE::COLOR)
+DECLARE_PROPERTY_TYPE(OrnamentStyle, P_TYPE::ORNAMENT_STYLE)
+DECLARE_PROPERTY_TYPE(OrnamentInterval, P_TYPE::ORNAMENT_INTERVAL)
+DECLARE_PROPERTY_TYPE(OrnamentShowAccidental, P_TYPE::ORNAMENT_SHOW_ACCIDENTAL)
+DECLARE_PROPERTY_TYPE(GlissandoStyle, P_TYPE::GLISS_STYLE)
+DECLARE_PROPERTY_TYPE(Align, P_TYPE::ALIGN)
+DECLARE_PROPERTY_TYPE(PlacementV, P_TYPE::PLACEMENT_V)
+DECLARE_PROPERTY_TYPE(PlacementH, P_TYPE::PLACEMENT_H)
+DECLARE_PROPERTY_TYPE(TextPlace, P_TYPE::TEXT_PLACE)
+DECLARE_PROPERTY_TYPE(DirectionV, P_TYPE::DIRECTION_V)
+DECLARE_PROPERTY_TYPE(DirectionH, P_TYPE::DIRECTION_H)
+DECLARE_PROPERTY_TYPE(Orientation, P_TYPE::ORIENTATION)
+DECLARE_PROPERTY_TYPE(BeamMode, P_TYPE::BEAM_MODE)
+DECLARE_PROPERTY_TYPE(AccidentalRole, P_TYPE::ACCIDENTAL_ROLE)
+DECLARE_PROPERTY_TYPE(TiePlacement, P_TYPE::TIE_PLACEMENT)
+DECLARE_PROPERTY_TYPE(Fraction, P_TYPE::FRACTION)
+DECLARE_PROPERTY_TYPE(DurationTypeWithDots, P_TYPE::DURATION_TYPE_WITH_DOTS)
+DECLARE_PROPERTY_TYPE(ChangeMethod, P_TYPE::CHANGE_METHOD)
+DECLARE_PROPERTY_TYPE(PitchValues, P_TYPE::PITCH_VALUES)
+DECLARE_PROPERTY_TYPE(BeatsPerSecond, P_TYPE::TEMPO)
+DECLARE_PROPERTY_TYPE(LayoutBreakType, P_TYPE::LAYOUTBREAK_TYPE)
+DECLARE_PROPERTY_TYPE(VeloType, P_TYPE::VELO_TYPE)
+DECLARE_PROPERTY_TYPE(BarLineType, P_TYPE::BARLINE_TYPE)
+DECLARE_PROPERTY_TYPE(NoteHeadType, P_TYPE::NOTEHEAD_TYPE)
+DECLARE_PROPERTY_TYPE(NoteHeadScheme, P_TYPE::NOTEHEAD_SCHEME)
+DECLARE_PROPERTY_TYPE(NoteHeadGroup, P_TYPE::NOTEHEAD_GROUP)
+DECLARE_PROPERTY_TYPE(ClefType, P_TYPE::CLEF_TYPE)
+DECLARE_PROPERTY_TYPE(ClefToBarlinePosition, P_TYPE::CLEF_TO_BARLINE_POS)
+DECLARE_PROPERTY_TYPE(DynamicType, P_TYPE::DYNAMIC_TYPE)
+DECLARE_PROPERTY_TYPE(DynamicRange, P_TYPE::DYNAMIC_RANGE)
+DECLARE_PROPERTY_TYPE(DynamicSpeed, P_TYPE::DYNAMIC_SPEED)
+DECLARE_PROPERTY_TYPE(LineType, P_TYPE::LINE_TYPE)
+DECLARE_PROPERTY_TYPE(HookType, P_TYPE::HOOK_TYPE)
+DECLARE_PROPERTY_TYPE(KeyMode, P_TYPE::KEY_MODE)
+DECLARE_PROPERTY_TYPE(TextStyleType, P_TYPE::TEXT_STYLE)
+DECLARE_PROPERTY_TYPE(PlayingTechniqueType, P_TYPE::PLAYTECH_TYPE)
+DECLARE_PROPERTY_TYPE(GradualTempoChangeType, P_TYPE::TEMPOCHANGE_TYPE)
+DECLARE_PROPERTY_TYPE(SlurStyleType, P_TYPE::SLUR_STYLE_TYPE)
+DECLARE_PROPERTY_TYPE(GroupNodes, P_TYPE::GROUPS)
+
+#undef DECLARE_PROPERTY_TYPE
+
 class PropertyValue
 {
 public:
     PropertyValue() = default;
 
+    PropertyValue(const PropertyValue& other)
+        : m_type(other.m_type) { copyFrom(other); }
+
+    PropertyValue(PropertyValue&& other) noexcept
+        : m_type(other.m_type) { moveFrom(other); }
+
+    ~PropertyValue() { reset(); }
+
+    PropertyValue& operator=(const PropertyValue& other)
+    {
+        if (this != &other) {
+            reset();
+            m_type = other.m_type;
+            copyFrom(other);
+        }
+        return *this;
+    }
+
+    PropertyValue& operator=(PropertyValue&& other) noexcept
+    {
+        if (this != &other) {
+            reset();
+            m_type = other.m_type;
+            moveFrom(other);
+        }
+        return *this;
+    }
+
     // Base
     PropertyValue(bool v)
-        : m_type(P_TYPE::BOOL), m_data(make_data<bool>(v)) {}
+        : m_type(P_TYPE::BOOL) { init<bool>(v); }
 
     PropertyValue(int v)
-        : m_type(P_TYPE::INT), m_data(make_data<int>(v)) {}
+        : m_type(P_TYPE::INT) { init<int>(v); }
 
     PropertyValue(const std::vector<int>& v)
-        : m_type(P_TYPE::INT_VEC), m_data(make_data<std::vector<int> >(v)) {}
+        : m_type(P_TYPE::INT_VEC) { init<std::vector<int> >(v); }
 
     PropertyValue(size_t v)
-        : m_type(P_TYPE::SIZE_T), m_data(make_data<size_t>(v)) {}
+        : m_type(P_TYPE::SIZE_T) { init<size_t>(v); }
 
     PropertyValue(double v)
-        : m_type(P_TYPE::REAL), m_data(make_data<double>(v)) {}
+        : m_type(P_TYPE::REAL) { init<double>(v); }
 
     PropertyValue(const char* v)
-        : m_type(P_TYPE::STRING), m_data(make_data<String>(String::fromUtf8(v))) {}
+        : m_type(P_TYPE::STRING) { init<String>(String::fromUtf8(v)); }
 
     PropertyValue(const String& v)
-        : m_type(P_TYPE::STRING), m_data(make_data<String>(v)) {}
+        : m_type(P_TYPE::STRING) { init<String>(v); }
 
 #ifndef NO_QT_SUPPORT
     PropertyValue(const QString& v)
-        : m_type(P_TYPE::STRING), m_data(make_data<String>(String::fromQString(v))) {}
+        : m_type(P_TYPE::STRING) { init<String>(String::fromQString(v)); }
 #endif
 
     // Geometry
     PropertyValue(const PointF& v)
-        : m_type(P_TYPE::POINT), m_data(make_data<PointF>(v)) {}
+        : m_type(P_TYPE::POINT) { init<PointF>(v); }
 
     PropertyValue(const PairF& v)
-        : m_type(P_TYPE::PAIR_REAL), m_data(make_data<PairF>(v)) {}
+        : m_type(P_TYPE::PAIR_REAL) { init<PairF>(v); }
 
     PropertyValue(const SizeF& v)
-        : m_type(P_TYPE::SIZE), m_data(make_data<SizeF>(v)) {}
+        : m_type(P_TYPE::SIZE) { init<SizeF>(v); }
 
     PropertyValue(const PainterPath& v)
-        : m_type(P_TYPE::DRAW_PATH), m_data(make_data<PainterPath>(v)) {}
+        : m_type(P_TYPE::DRAW_PATH) { init<PainterPath>(v); }
 
     PropertyValue(const ScaleF& v)
-        : m_type(P_TYPE::SCALE), m_data(make_data<ScaleF>(v)) {}
+        : m_type(P_TYPE::SCALE) { init<ScaleF>(v); }
 
     PropertyValue(const Spatium& v)
-        : m_type(P_TYPE::SPATIUM), m_data(make_data<Spatium>(v)) {}
+        : m_type(P_TYPE::SPATIUM) { init<Spatium>(v); }
 
     PropertyValue(const Millimetre& v)
-        : m_type(P_TYPE::MILLIMETRE), m_data(make_data<Millimetre>(v)) {}
+        : m_type(P_TYPE::MILLIMETRE) { init<Millimetre>(v); }
 
     // Draw
     PropertyValue(SymId v)
-        : m_type(P_TYPE::SYMID), m_data(make_data<SymId>(v)) {}
+        : m_type(P_TYPE::SYMID) { init<SymId>(v); }
 
     PropertyValue(const Color& v)
-        : m_type(P_TYPE::COLOR), m_data(make_data<Color>(v)) {}
+        : m_type(P_TYPE::COLOR) { init<Color>(v); }
 
     PropertyValue(OrnamentStyle v)
-        : m_type(P_TYPE::ORNAMENT_STYLE), m_data(make_data<OrnamentStyle>(v)) {}
+        : m_type(P_TYPE::ORNAMENT_STYLE) { init<OrnamentStyle>(v); }
 
     PropertyValue(GlissandoStyle v)
-        : m_type(P_TYPE::GLISS_STYLE), m_data(make_data<GlissandoStyle>(v)) {}
+        : m_type(P_TYPE::GLISS_STYLE) { init<GlissandoStyle>(v); }
 
     // Layout
     PropertyValue(Align v)
-        : m_type(P_TYPE::ALIGN), m_data(make_data<Align>(v)) {}
+        : m_type(P_TYPE::ALIGN) { init<Align>(v); }
 
     PropertyValue(PlacementV v)
-        : m_type(P_TYPE::PLACEMENT_V), m_data(make_data<PlacementV>(v)) {}
+        : m_type(P_TYPE::PLACEMENT_V) { init<PlacementV>(v); }
     PropertyValue(PlacementH v)
-        : m_type(P_TYPE::PLACEMENT_H), m_data(make_data<PlacementH>(v)) {}
+        : m_type(P_TYPE::PLACEMENT_H) { init<PlacementH>(v); }
 
     PropertyValue(TextPlace v)
-        : m_type(P_TYPE::TEXT_PLACE), m_data(make_data<TextPlace>(v)) {}
+        : m_type(P_TYPE::TEXT_PLACE) { init<TextPlace>(v); }
 
     PropertyValue(DirectionV v)
-        : m_type(P_TYPE::DIRECTION_V), m_data(make_data<DirectionV>(v)) {}
+        : m_type(P_TYPE::DIRECTION_V) { init<DirectionV>(v); }
     PropertyValue(DirectionH v)
-        : m_type(P_TYPE::DIRECTION_H), m_data(make_data<DirectionH>(v)) {}
+        : m_type(P_TYPE::DIRECTION_H) { init<DirectionH>(v); }
 
     PropertyValue(Orientation v)
-        : m_type(P_TYPE::ORIENTATION), m_data(make_data<Orientation>(v)) {}
+        : m_type(P_TYPE::ORIENTATION) { init<Orientation>(v); }
 
     PropertyValue(BeamMode v)
-        : m_type(P_TYPE::BEAM_MODE), m_data(make_data<BeamMode>(v)) {}
+        : m_type(P_TYPE::BEAM_MODE) { init<BeamMode>(v); }
 
     PropertyValue(const AccidentalRole& v)
-        : m_type(P_TYPE::ACCIDENTAL_ROLE), m_data(make_data<AccidentalRole>(v)) {}
+        : m_type(P_TYPE::ACCIDENTAL_ROLE) { init<AccidentalRole>(v); }
 
     PropertyValue(TiePlacement v)
-        : m_type(P_TYPE::TIE_PLACEMENT), m_data(make_data<TiePlacement>(v)) {}
+        : m_type(P_TYPE::TIE_PLACEMENT) { init<TiePlacement>(v); }
 
     // Sound
     PropertyValue(const Fraction& v)
-        : m_type(P_TYPE::FRACTION), m_data(make_data<Fraction>(v)) {}
+        : m_type(P_TYPE::FRACTION) { init<Fraction>(v); }
     PropertyValue(const DurationTypeWithDots& v)
-        : m_type(P_TYPE::DURATION_TYPE_WITH_DOTS), m_data(make_data<DurationTypeWithDots>(v)) {}
+        : m_type(P_TYPE::DURATION_TYPE_WITH_DOTS) { init<DurationTypeWithDots>(v); }
     PropertyValue(ChangeMethod v)
-        : m_type(P_TYPE::CHANGE_METHOD), m_data(make_data<ChangeMethod>(v)) {}
+        : m_type(P_TYPE::CHANGE_METHOD) { init<ChangeMethod>(v); }
     PropertyValue(const PitchValues& v)
-        : m_type(P_TYPE::PITCH_VALUES), m_data(make_data<PitchValues>(v)) {}
+        : m_type(P_TYPE::PITCH_VALUES) { init<PitchValues>(v); }
     PropertyValue(const BeatsPerSecond& v)
-        : m_type(P_TYPE::TEMPO), m_data(make_data<BeatsPerSecond>(v)) {}
+        : m_type(P_TYPE::TEMPO) { init<BeatsPerSecond>(v); }
 
     // Types
     PropertyValue(LayoutBreakType v)
-        : m_type(P_TYPE::LAYOUTBREAK_TYPE), m_data(make_data<LayoutBreakType>(v)) {}
+        : m_type(P_TYPE::LAYOUTBREAK_TYPE) { init<LayoutBreakType>(v); }
 
     PropertyValue(VeloType v)
-        : m_type(P_TYPE::VELO_TYPE), m_data(make_data<VeloType>(v)) {}
+        : m_type(P_TYPE::VELO_TYPE) { init<VeloType>(v); }
 
     PropertyValue(BarLineType v)
-        : m_type(P_TYPE::BARLINE_TYPE), m_data(make_data<BarLineType>(v)) {}
+        : m_type(P_TYPE::BARLINE_TYPE) { init<BarLineType>(v); }
 
     PropertyValue(NoteHeadType v)
-        : m_type(P_TYPE::NOTEHEAD_TYPE), m_data(make_data<NoteHeadType>(v)) {}
+        : m_type(P_TYPE::NOTEHEAD_TYPE) { init<NoteHeadType>(v); }
     PropertyValue(NoteHeadScheme v)
-        : m_type(P_TYPE::NOTEHEAD_SCHEME), m_data(make_data<NoteHeadScheme>(v)) {}
+        : m_type(P_TYPE::NOTEHEAD_SCHEME) { init<NoteHeadScheme>(v); }
     PropertyValue(NoteHeadGroup v)
-        : m_type(P_TYPE::NOTEHEAD_GROUP), m_data(make_data<NoteHeadGroup>(v)) {}
+        : m_type(P_TYPE::NOTEHEAD_GROUP) { init<NoteHeadGroup>(v); }
 
     PropertyValue(ClefType v)
-        : m_type(P_TYPE::CLEF_TYPE), m_data(make_data<ClefType>(v)) {}
+        : m_type(P_TYPE::CLEF_TYPE) { init<ClefType>(v); }
 
     PropertyValue(ClefToBarlinePosition v)
-        : m_type(P_TYPE::CLEF_TO_BARLINE_POS), m_data(make_data<ClefToBarlinePosition>(v)) {}
+        : m_type(P_TYPE::CLEF_TO_BARLINE_POS) { init<ClefToBarlinePosition>(v); }
 
     PropertyValue(DynamicType v)
-        : m_type(P_TYPE::DYNAMIC_TYPE), m_data(make_data<DynamicType>(v)) {}
+        : m_type(P_TYPE::DYNAMIC_TYPE) { init<DynamicType>(v); }
     PropertyValue(DynamicRange v)
-        : m_type(P_TYPE::DYNAMIC_RANGE), m_data(make_data<DynamicRange>(v)) {}
+        : m_type(P_TYPE::DYNAMIC_RANGE) { init<DynamicRange>(v); }
     PropertyValue(DynamicSpeed v)
-        : m_type(P_TYPE::DYNAMIC_SPEED), m_data(make_data<DynamicSpeed>(v)) {}
+        : m_type(P_TYPE::DYNAMIC_SPEED) { init<DynamicSpeed>(v); }
 
     PropertyValue(LineType v)
-        : m_type(P_TYPE::LINE_TYPE), m_data(make_data<LineType>(v)) {}
+        : m_type(P_TYPE::LINE_TYPE) { init<LineType>(v); }
     PropertyValue(HookType v)
-        : m_type(P_TYPE::HOOK_TYPE), m_data(make_data<HookType>(v)) {}
+        : m_type(P_TYPE::HOOK_TYPE) { init<HookType>(v); }
 
     PropertyValue(KeyMode v)
-        : m_type(P_TYPE::KEY_MODE), m_data(make_data<KeyMode>(v)) {}
+        : m_type(P_TYPE::KEY_MODE) { init<KeyMode>(v); }
 
     PropertyValue(TextStyleType v)
-        : m_type(P_TYPE::TEXT_STYLE), m_data(make_data<TextStyleType>(v)) {}
+        : m_type(P_TYPE::TEXT_STYLE) { init<TextStyleType>(v); }
 
     PropertyValue(PlayingTechniqueType v)
-        : m_type(P_TYPE::PLAYTECH_TYPE), m_data(make_data<PlayingTechniqueType>(v)) {}
+        : m_type(P_TYPE::PLAYTECH_TYPE) { init<PlayingTechniqueType>(v); }
 
     PropertyValue(GradualTempoChangeType v)
-        : m_type(P_TYPE::TEMPOCHANGE_TYPE), m_data(make_data<GradualTempoChangeType>(v)) {}
+        : m_type(P_TYPE::TEMPOCHANGE_TYPE) { init<GradualTempoChangeType>(v); }
 
     PropertyValue(SlurStyleType v)
-        : m_type(P_TYPE::SLUR_STYLE_TYPE), m_data(make_data<SlurStyleType>(v)) {}
+        : m_type(P_TYPE::SLUR_STYLE_TYPE) { init<SlurStyleType>(v); }
 
     // Other
     PropertyValue(const GroupNodes& v)
-        : m_type(P_TYPE::GROUPS), m_data(make_data<GroupNodes>(v)) {}
+        : m_type(P_TYPE::GROUPS) { init<GroupNodes>(v); }
 
     PropertyValue(const OrnamentInterval& v)
-        : m_type(P_TYPE::ORNAMENT_INTERVAL), m_data(make_data<OrnamentInterval>(v)) {}
+        : m_type(P_TYPE::ORNAMENT_INTERVAL) { init<OrnamentInterval>(v); }
 
     PropertyValue(const OrnamentShowAccidental& v)
-        : m_type(P_TYPE::ORNAMENT_SHOW_ACCIDENTAL), m_data(make_data<OrnamentShowAccidental>(v)) {}
+        : m_type(P_TYPE::ORNAMENT_SHOW_ACCIDENTAL) { init<OrnamentShowAccidental>(v); }
 
     bool isValid() const;
 
     P_TYPE type() const;
-    bool isEnum() const { return m_data ? m_data->isEnum() : false; }
+    bool isEnum() const { return m_ops ? m_ops->isEnum : false; }
+
+    //! NOTE Approximate number of bytes allocated on the heap for the value (not including sizeof(PropertyValue))
+    size_t dataSize() const { return m_ops ? m_ops->dataSize(m_storage) : 0; }
 
     template<typename T>
     T value() const
@@ -291,12 +395,7 @@ public:
             return T();
         }
 
-        assert(m_data);
-        if (!m_data) {
-            return T();
-        }
-
-        Arg<T>* at = get<T>();
+        const T* at = get<T>();
         if (!at) {
             //! HACK Temporary hack for int to enum
             if constexpr (std::is_enum<T>::value) {
@@ -307,8 +406,8 @@ public:
 
             //! HACK Temporary hack for enum to int
             if constexpr (std::is_same<T, int>::value) {
-                if (m_data->isEnum()) {
-                    return m_data->enumToInt();
+                if (m_ops->isEnum) {
+                    return m_ops->enumToInt(m_storage);
                 }
             }
 
@@ -334,9 +433,9 @@ public:
             //! HACK Temporary hack for real to Spatium
             if constexpr (std::is_same<T, Spatium>::value) {
                 if (P_TYPE::REAL == m_type) {
-                    Arg<double>* srv = get<double>();
+                    const double* srv = get<double>();
                     assert(srv);
-                    return srv ? Spatium(srv->v) : Spatium();
+                    return srv ? Spatium(*srv) : Spatium();
                 }
             }
 
@@ -350,9 +449,9 @@ public:
             //! HACK Temporary hack for real to Millimetre
             if constexpr (std::is_same<T, Millimetre>::value) {
                 if (P_TYPE::REAL == m_type) {
-                    Arg<double>* mrv = get<double>();
+                    const double* mrv = get<double>();
                     assert(mrv);
-                    return mrv ? Millimetre(mrv->v) : Millimetre();
+                    return mrv ? Millimetre(*mrv) : Millimetre();
                 }
             }
 
@@ -389,7 +488,7 @@ public:
         if (!at) {
             return T();
         }
-        return at->v;
+        return *at;
     }
 
     bool toBool() const { return value<bool>(); }
@@ -410,59 +509,166 @@ public:
 #endif
 
 private:
-    struct IArg {
-        virtual ~IArg() = default;
+    //! NOTE Values that are small and cheap to copy are stored inline, without allocation,
+    //! the rest (paths, vectors) are stored in a shared immutable heap block
+    static constexpr size_t INLINE_SIZE = 16;
 
-        virtual bool equal(const IArg* a) const = 0;
+    template<typename T>
+    static constexpr bool IS_INLINE = sizeof(T) <= INLINE_SIZE
+                                      && alignof(T) <= alignof(std::max_align_t)
+                                      && std::is_nothrow_copy_constructible<T>::value
+                                      && std::is_nothrow_move_constructible<T>::value;
 
-        virtual bool isEnum() const = 0;
-        virtual int enumToInt() const = 0;
+    template<typename T>
+    using Stored = std::conditional_t<IS_INLINE<T>, T, std::shared_ptr<const T> >;
+
+    //! NOTE Per type operations, copy/move/destroy are null for trivially copyable values
+    struct Ops {
+        bool (*equal)(const void* a, const void* b);
+        int (*enumToInt)(const void* v);
+        bool isEnum;
+        void (*copy)(void* dst, const void* src);
+        void (*move)(void* dst, void* src);
+        void (*destroy)(void* v);
+        size_t (*dataSize)(const void* v);
     };
 
     template<typename T>
-    struct Arg : public IArg {
-        T v;
-        Arg(const T& v)
-            : IArg(), v(v) {}
-
-        bool equal(const IArg* a) const override
-        {
-            assert(a);
-            const Arg<T>* at = dynamic_cast<const Arg<T>*>(a);
-            assert(at);
-            return at ? at->v == v : false;
+    static const T* valuePtr(const void* storage)
+    {
+        const Stored<T>* stored = std::launder(reinterpret_cast<const Stored<T>*>(storage));
+        if constexpr (IS_INLINE<T>) {
+            return stored;
+        } else {
+            return stored->get();
         }
+    }
 
-        //! HACK Temporary hack for enum to int
-        bool isEnum() const override
-        {
-            return std::is_enum<T>::value;
+    template<typename T>
+    static bool equalValues(const void* a, const void* b)
+    {
+        return *valuePtr<T>(a) == *valuePtr<T>(b);
+    }
+
+    //! HACK Temporary hack for enum to int
+    template<typename T>
+    static int enumToIntValue([[maybe_unused]] const void* v)
+    {
+        if constexpr (std::is_enum<T>::value) {
+            return static_cast<int>(*valuePtr<T>(v));
+        } else {
+            return -1;
         }
+    }
 
-        int enumToInt() const override
-        {
-            if constexpr (std::is_enum<T>::value) {
-                return static_cast<int>(v);
-            } else {
-                return -1;
-            }
+    template<typename T>
+    static void copyStored(void* dst, const void* src)
+    {
+        new (dst) Stored<T>(*std::launder(reinterpret_cast<const Stored<T>*>(src)));
+    }
+
+    template<typename T>
+    static void moveStored(void* dst, void* src)
+    {
+        Stored<T>* s = std::launder(reinterpret_cast<Stored<T>*>(src));
+        new (dst) Stored<T>(std::move(*s));
+        s->~Stored<T>();
+    }
+
+    template<typename T>
+    static void destroyStored(void* v)
+    {
+        std::launder(reinterpret_cast<Stored<T>*>(v))->~Stored<T>();
+    }
+
+    template<typename T>
+    static size_t storedDataSize(const void* v)
+    {
+        size_t size = 0;
+        if constexpr (!IS_INLINE<T>) {
+            //! NOTE make_shared allocates the control block together with the value
+            size += sizeof(T) + 2 * sizeof(void*);
+        }
+        if constexpr (std::is_same<T, String>::value) {
+            size += valuePtr<T>(v)->size() * sizeof(char16_t);
         }
+        return size;
+    }
+
+    template<typename T>
+    static constexpr bool IS_TRIVIAL = std::is_trivially_copyable<Stored<T> >::value;
+
+    template<typename T>
+    static constexpr Ops OPS = {
+        &equalValues<T>,
+        &enumToIntValue<T>,
+        std::is_enum<T>::value,
+        IS_TRIVIAL<T> ? nullptr : &copyStored<T>,
+        IS_TRIVIAL<T> ? nullptr : &moveStored<T>,
+        IS_TRIVIAL<T> ? nullptr : &destroyStored<T>,
+        &storedDataSize<T>
     };
 
     template<typename T>
-    inline std::shared_ptr<IArg> make_data(const T& v) const
+    inline void init(const T& v)
     {
-        return std::shared_ptr<IArg>(new Arg<T>(v));
+        static_assert(PropertyTypeOf<T>::value != P_TYPE::UNDEFINED, "type is not registered as a property type");
+        assert(m_type == PropertyTypeOf<T>::value);
+
+        if constexpr (IS_INLINE<T>) {
+            new (m_storage) T(v);
+        } else {
+            new (m_storage) std::shared_ptr<const T>(std::make_shared<const T>(v));
+        }
+        m_ops = &OPS<T>;
     }
 
     template<typename T>
-    inline Arg<T>* get() const
+    inline const T* get() const
     {
-        return dynamic_cast<Arg<T>*>(m_data.get());
+        if constexpr (PropertyTypeOf<T>::value == P_TYPE::UNDEFINED) {
+            return nullptr;
+        } else {
+            if (m_type != PropertyTypeOf<T>::value) {
+                return nullptr;
+            }
+            return valuePtr<T>(m_storage);
+        }
+    }
+
+    inline void copyFrom(const PropertyValue& other)
+    {
+        m_ops = other.m_ops;
+        if (m_ops && m_ops->copy) {
+            m_ops->copy(m_storage, other.m_storage);
+        } else {
+            std::memcpy(m_storage, other.m_storage, INLINE_SIZE);
+        }
+    }
+
+    inline void moveFrom(PropertyValue& other)
+    {
+        m_ops = other.m_ops;
+        if (m_ops && m_ops->move) {
+            m_ops->move(m_storage, other.m_storage);
+        } else {
+            std::memcpy(m_storage, other.m_storage, INLINE_SIZE);
+        }
+        other.m_type = P_TYPE::UNDEFINED;
+        other.m_ops = nullptr;
+    }
+
+    inline void reset()
+    {
+        if (m_ops && m_ops->destroy) {
+            m_ops->destroy(m_storage);
+        }
+        m_ops = nullptr;
     }
 
     P_TYPE m_type = P_TYPE::UNDEFINED;
-    std::shared_ptr<IArg> m_data = nullptr;
+    const Ops* m_ops = nullptr;
+    alignas(std::max_align_t) unsigned char m_storage[INLINE_SIZE] = {};
 };
 }
 
@@ -360,6 +360,20 @@ Align TConv::fromXml(const String& str, Align def)
     return a;
 }
 
+Align TConv::fromXml(const AsciiStringView& str, Align def)
+{
+    size_t sep = str.indexOf(',');
+    if (sep == mu::nidx) {
+        LOGD() << "bad align value: " << str;
+        return def;
+    }
+
+    Align a;
+    a.horizontal = findTypeByXmlTag<AlignH>(ALIGN_H, AsciiStringView(str.ascii(), sep), def.horizontal);
+    a.vertical = findTypeByXmlTag<AlignV>(ALIGN_V, AsciiStringView(str.ascii() + sep + 1, str.size() - sep - 1), def.vertical);
+    return a;
+}
+
 static const std::vector<Item<IntervalStep> > INTERVAL_STEP = {
     { IntervalStep::UNISON, "unison" },
     { IntervalStep::SECOND, "second" },
@@ -241,6 +241,11 @@ void AudioModule::onDeinit()
     if (m_audioDriver->isOpened()) {
         m_audioDriver->close();
     }
+
+    AudioBuffer::Stats stats = m_audioBuffer->stats();
+    LOGI() << "audio buffer: underruns: " << stats.underruns
+           << ", data requests: " << stats.dataRequests
+           << ", render ahead: " << stats.renderAheadSamples << " samples";
 }
 
 void AudioModule::onDestroy()
@@ -308,5 +313,12 @@ void AudioModule::setupAudioWorker(const IAudioDriver::Spec& activeSpec)
         m_audioBuffer->forward();
     };
 
-    m_audioWorker->run(workerSetup, workerLoopBody);
+    //! NOTE The worker sleeps until the driver has consumed data;
+    //! the timeout bounds the latency of async events and keeps rendering going without a driver
+    auto workerWaitForWork = [this]() {
+        static constexpr std::chrono::milliseconds MAX_WAIT_TIME(2);
+        m_audioBuffer->waitForDataRequest(MAX_WAIT_TIME);
+    };
+
+    m_audioWorker->run(workerSetup, workerLoopBody, workerWaitForWork);
 }
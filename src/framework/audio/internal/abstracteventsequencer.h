@@ -23,13 +23,15 @@
 #ifndef MU_AUDIO_ABSTRACTEVENTSEQUENCER_H
 #define MU_AUDIO_ABSTRACTEVENTSEQUENCER_H
 
+#include <limits>
 #include <map>
-#include <set>
+#include <vector>
 
 #include "async/asyncable.h"
 #include "mpe/events.h"
 
 #include "audiosanitizer.h"
+#include "eventtimeline.h"
 #include "../audiotypes.h"
 
 namespace mu::audio {
@@ -38,15 +40,13 @@ class AbstractEventSequencer : public async::Asyncable
 {
 public:
     using EventType = std::variant<Types...>;
-    using EventSequence = std::set<EventType>;
-    using EventSequenceMap = std::map<msecs_t, EventSequence>;
-
-    typedef typename EventSequenceMap::const_iterator SequenceIterator;
-    typedef typename EventSequence::const_iterator EventIterator;
+    using EventSequence = std::vector<EventType>;
+    using Timeline = EventTimeline<EventType>;
 
     virtual ~AbstractEventSequencer()
     {
         m_mainStreamChanges.resetOnReceive(this);
+        m_mainStreamDeltaChanges.resetOnReceive(this);
         m_offStreamChanges.resetOnReceive(this);
         m_dynamicLevelChanges.resetOnReceive(this);
     }
@@ -56,11 +56,13 @@ public:
         ONLY_AUDIO_WORKER_THREAD;
 
         m_mainStreamChanges = data.mainStream;
+        m_mainStreamDeltaChanges = data.mainStreamDelta;
         m_offStreamChanges = data.offStream;
         m_dynamicLevelChanges = data.dynamicLevelChanges;
 
         m_playbackEventsMap = data.originEvents;
         m_dynamicLevelMap = data.dynamicLevelMap;
+        updateEventTimeBounds();
 
         m_offStreamChanges.onReceive(this, [this](const mpe::PlaybackEventsMap& changes) {
             updateOffStreamEvents(changes);
@@ -68,9 +70,14 @@ public:
 
         m_mainStreamChanges.onReceive(this, [this](const mpe::PlaybackEventsMap& changes) {
             m_playbackEventsMap = changes;
+            updateEventTimeBounds();
             updateMainStreamEvents(changes);
         });
 
+        m_mainStreamDeltaChanges.onReceive(this, [this](const mpe::PlaybackEventsDelta& delta) {
+            applyMainStreamDelta(delta);
+        });
+
         m_dynamicLevelChanges.onReceive(this, [this](const mpe::DynamicLevelMap& changes) {
             m_dynamicLevelMap = changes;
             updateDynamicChanges(changes);
@@ -84,6 +91,15 @@ public:
     virtual void updateMainStreamEvents(const mpe::PlaybackEventsMap& changes) = 0;
     virtual void updateDynamicChanges(const mpe::DynamicLevelMap& changes) = 0;
 
+    //! NOTE By default the whole main stream is rebuilt,
+    //! sequencers which are able to rebuild only the affected part should override it
+    virtual void applyMainStreamDelta(const mpe::PlaybackEventsDelta& delta)
+    {
+        mpe::applyPlaybackEventsDelta(m_playbackEventsMap, delta);
+        updateEventTimeBounds();
+        updateMainStreamEvents(m_playbackEventsMap);
+    }
+
     void setActive(const bool active)
     {
         m_isActive = active;
@@ -143,109 +159,231 @@ public:
         return std::prev(upper)->second;
     }
 
-    EventSequence eventsToBePlayed(const msecs_t nextMsecs)
+    //! NOTE Returns the events which are due within the next block.
+    //! The returned sequence is reused by the next call, so nothing is allocated once it has grown enough
+    const EventSequence& eventsToBePlayed(const msecs_t nextMsecs)
     {
         ONLY_AUDIO_WORKER_THREAD;
 
-        EventSequence result;
+        m_eventsToBePlayed.clear();
+        m_eventOffsets.clear();
 
         if (!m_isActive) {
-            handleOffStream(result, nextMsecs);
-            return result;
+            handleOffStream(nextMsecs);
+            return m_eventsToBePlayed;
         }
 
-        if (m_currentMainSequenceIt == m_mainStreamEvents.cend()) {
-            return result;
+        if (m_currentMainSequenceIdx >= m_mainStreamEvents.size()) {
+            return m_eventsToBePlayed;
         }
 
+        const msecs_t blockStart = m_playbackPosition;
         m_playbackPosition += nextMsecs;
 
-        handleMainStream(result);
-        handleDynamicChanges(result);
+        handleMainStreamAndDynamicChanges(blockStart);
+
+        return m_eventsToBePlayed;
+    }
+
+    //! NOTE Offsets of the events returned by the last eventsToBePlayed() call from the start of the block,
+    //! in the same order as the events. They are ascending, so the block may be rendered in parts between them
+    const std::vector<msecs_t>& eventOffsets() const
+    {
+        ONLY_AUDIO_WORKER_THREAD;
 
-        return result;
+        return m_eventOffsets;
     }
 
 protected:
     void resetAllIterators()
     {
+        // the off stream is played independently from the playback position
         updateMainSequenceIterator();
-        updateOffSequenceIterator();
         updateDynamicChangesIterator();
     }
 
     void updateMainSequenceIterator()
     {
-        m_currentMainSequenceIt = m_mainStreamEvents.lower_bound(m_playbackPosition);
+        m_mainStreamEvents.finalize();
+        m_currentMainSequenceIdx = m_mainStreamEvents.lowerBound(m_playbackPosition);
     }
 
     void updateOffSequenceIterator()
     {
-        m_currentOffSequenceIt = m_offStreamEvents.cbegin();
+        m_offStreamEvents.finalize();
+        m_currentOffSequenceIdx = 0;
+        m_offStreamPosition = 0;
     }
 
     void updateDynamicChangesIterator()
     {
-        m_currentDynamicsIt = m_dynamicEvents.lower_bound(m_playbackPosition);
+        m_dynamicEvents.finalize();
+        m_currentDynamicsIdx = m_dynamicEvents.lowerBound(m_playbackPosition);
     }
 
-    void handleOffStream(EventSequence& result, const msecs_t nextMsecs)
+    //! NOTE Rebuilds only the part of the main stream events which is affected by the delta.
+    //!      render(destination, events) has to put the events, produced by the given playback events,
+    //!      into the destination. The produced events must lie within mpe::playbackEventTimeRange()
+    template<typename RenderFunc>
+    void applyMainStreamDeltaPartially(const mpe::PlaybackEventsDelta& delta, RenderFunc render)
     {
-        if (m_offStreamEvents.empty() || m_currentOffSequenceIt == m_offStreamEvents.cend()) {
+        mpe::TimestampRange window { std::numeric_limits<msecs_t>::max(), std::numeric_limits<msecs_t>::min() };
+
+        auto expandWindow = [this, &window](const msecs_t timestamp, const mpe::PlaybackEventList& events) {
+            for (const mpe::PlaybackEvent& event : events) {
+                mpe::TimestampRange range = mpe::playbackEventTimeRange(timestamp, event);
+                window.from = std::min(window.from, range.from);
+                window.to = std::max(window.to, range.to);
+
+                m_maxEventLeadTime = std::max(m_maxEventLeadTime, timestamp - range.from);
+                m_maxEventTailTime = std::max(m_maxEventTailTime, range.to - timestamp);
+            }
+        };
+
+        // the window of the rendered events, which is affected by the replaced and by the new events
+        for (const mpe::TimestampRange& range : delta.ranges) {
+            auto it = m_playbackEventsMap.lower_bound(range.from);
+            auto last = m_playbackEventsMap.upper_bound(range.to);
+
+            for (; it != last; ++it) {
+                expandWindow(it->first, it->second);
+            }
+        }
+
+        for (const auto& pair : delta.events) {
+            expandWindow(pair.first, pair.second);
+        }
+
+        mpe::applyPlaybackEventsDelta(m_playbackEventsMap, delta);
+
+        if (window.from > window.to) {
             return;
         }
 
-        if (m_currentOffSequenceIt->first <= nextMsecs) {
-            result = m_currentOffSequenceIt->second;
-            m_currentOffSequenceIt = m_offStreamEvents.erase(m_currentOffSequenceIt);
-        } else {
-            auto node = m_offStreamEvents.extract(m_currentOffSequenceIt);
-            node.key() -= nextMsecs;
-            m_offStreamEvents.insert(std::move(node));
-            updateOffSequenceIterator();
+        if (m_playbackPosition >= window.from && m_playbackPosition <= window.to && m_onMainStreamFlushed) {
+            m_onMainStreamFlushed();
         }
+
+        // everything inside the window is rendered again from the events which are able to reach it
+        mpe::TimestampRange candidatesRange { window.from - m_maxEventTailTime, window.to + m_maxEventLeadTime };
+        mpe::PlaybackEventsMap candidates = mpe::playbackEventsInRanges(m_playbackEventsMap, { candidatesRange });
+
+        Timeline rendered;
+        render(rendered, candidates);
+        rendered.finalize();
+
+        m_mainStreamEvents.finalize();
+        m_mainStreamEvents.replace(window.from, window.to, rendered);
+
+        updateMainSequenceIterator();
     }
 
-    void handleMainStream(EventSequence& result)
+    void updateEventTimeBounds()
     {
-        if (m_currentMainSequenceIt->first <= m_playbackPosition) {
-            result.insert(m_currentMainSequenceIt->second.cbegin(),
-                          m_currentMainSequenceIt->second.cend());
+        m_maxEventLeadTime = 0;
+        m_maxEventTailTime = 0;
+
+        for (const auto& pair : m_playbackEventsMap) {
+            for (const mpe::PlaybackEvent& event : pair.second) {
+                mpe::TimestampRange range = mpe::playbackEventTimeRange(pair.first, event);
 
-            m_currentMainSequenceIt = std::next(m_currentMainSequenceIt);
+                m_maxEventLeadTime = std::max(m_maxEventLeadTime, pair.first - range.from);
+                m_maxEventTailTime = std::max(m_maxEventTailTime, range.to - pair.first);
+            }
         }
     }
 
-    void handleDynamicChanges(EventSequence& result)
+    void handleOffStream(const msecs_t nextMsecs)
     {
-        if (m_dynamicEvents.empty() || m_currentDynamicsIt == m_dynamicEvents.cend()) {
+        if (m_currentOffSequenceIdx >= m_offStreamEvents.size()) {
             return;
         }
 
-        if (m_currentDynamicsIt->first <= m_playbackPosition) {
-            result.insert(m_currentDynamicsIt->second.cbegin(),
-                          m_currentDynamicsIt->second.cend());
+        const msecs_t blockStart = m_offStreamPosition;
+        m_offStreamPosition += nextMsecs;
+
+        while (m_currentOffSequenceIdx < m_offStreamEvents.size()) {
+            const typename Timeline::Entry& entry = m_offStreamEvents.at(m_currentOffSequenceIdx);
+            if (entry.timestamp > m_offStreamPosition) {
+                break;
+            }
+
+            addEventToBePlayed(entry, blockStart);
+            ++m_currentOffSequenceIdx;
+        }
+    }
 
-            m_currentDynamicsIt = std::next(m_currentDynamicsIt);
+    //! NOTE Appends the main stream events and the dynamic changes up to the playback position,
+    //! merged by their timestamps, so that the offsets stay ascending
+    void handleMainStreamAndDynamicChanges(const msecs_t blockStart)
+    {
+        const size_t mainSize = m_mainStreamEvents.size();
+        const size_t dynamicsSize = m_dynamicEvents.size();
+
+        while (true) {
+            const typename Timeline::Entry* mainEntry = nullptr;
+            if (m_currentMainSequenceIdx < mainSize) {
+                mainEntry = &m_mainStreamEvents.at(m_currentMainSequenceIdx);
+                if (mainEntry->timestamp > m_playbackPosition) {
+                    mainEntry = nullptr;
+                }
+            }
+
+            const typename Timeline::Entry* dynamicEntry = nullptr;
+            if (m_currentDynamicsIdx < dynamicsSize) {
+                dynamicEntry = &m_dynamicEvents.at(m_currentDynamicsIdx);
+                if (dynamicEntry->timestamp > m_playbackPosition) {
+                    dynamicEntry = nullptr;
+                }
+            }
+
+            if (!mainEntry && !dynamicEntry) {
+                break;
+            }
+
+            // on equal timestamps the dynamic change goes first, so that it affects the notes starting there
+            if (dynamicEntry && (!mainEntry || dynamicEntry->timestamp <= mainEntry->timestamp)) {
+                addEventToBePlayed(*dynamicEntry, blockStart);
+                ++m_currentDynamicsIdx;
+            } else {
+                addEventToBePlayed(*mainEntry, blockStart);
+                ++m_currentMainSequenceIdx;
+            }
         }
     }
 
+    void addEventToBePlayed(const typename Timeline::Entry& entry, const msecs_t blockStart)
+    {
+        // the events left behind by a position change are played at the start of the block
+        m_eventsToBePlayed.push_back(entry.event);
+        m_eventOffsets.push_back(std::max(entry.timestamp - blockStart, msecs_t(0)));
+    }
+
     mutable msecs_t m_playbackPosition = 0;
+    msecs_t m_offStreamPosition = 0;
 
-    SequenceIterator m_currentMainSequenceIt;
-    SequenceIterator m_currentOffSequenceIt;
-    SequenceIterator m_currentDynamicsIt;
+    size_t m_currentMainSequenceIdx = 0;
+    size_t m_currentOffSequenceIdx = 0;
+    size_t m_currentDynamicsIdx = 0;
 
-    EventSequenceMap m_mainStreamEvents;
-    EventSequenceMap m_offStreamEvents;
-    EventSequenceMap m_dynamicEvents;
+    Timeline m_mainStreamEvents;
+    Timeline m_offStreamEvents;
+    Timeline m_dynamicEvents;
+
+    EventSequence m_eventsToBePlayed;
+    std::vector<msecs_t> m_eventOffsets;
 
     mpe::DynamicLevelMap m_dynamicLevelMap;
     mpe::PlaybackEventsMap m_playbackEventsMap;
 
+    // how far the events may reach before/after their timestamps in m_playbackEventsMap
+    msecs_t m_maxEventLeadTime = 0;
+    msecs_t m_maxEventTailTime = 0;
+
     bool m_isActive = false;
 
     mpe::PlaybackEventsChanges m_mainStreamChanges;
+    mpe::PlaybackEventsDeltaChanges m_mainStreamDeltaChanges;
     mpe::PlaybackEventsChanges m_offStreamChanges;
     mpe::DynamicLevelChanges m_dynamicLevelChanges;
 
@@ -31,6 +31,9 @@ static constexpr size_t DEFAULT_SIZE = DEFAULT_SIZE_PER_CHANNEL * 2;
 
 static const std::vector<float> SILENT_FRAMES(DEFAULT_SIZE, 0.f);
 
+//! NOTE The render-ahead is reduced by one render step after this number of reads without underruns
+static constexpr size_t STABLE_READS_TO_SHRINK = 2000;
+
 //#define DEBUG_AUDIO
 #ifdef DEBUG_AUDIO
 #define LOG_AUDIO LOGD
@@ -114,6 +117,8 @@ void AudioBuffer::init(const audioch_t audioChannelsCount, const samples_t rende
     m_renderStep = renderStep;
 
     m_data.resize(m_samplesPerChannel * m_audioChannelsCount, 0.f);
+
+    m_renderAhead.store(maxRenderAhead(), std::memory_order_relaxed);
 }
 
 void AudioBuffer::setSource(std::shared_ptr<IAudioSource> source)
@@ -127,6 +132,10 @@ void AudioBuffer::setSource(std::shared_ptr<IAudioSource> source)
     }
 
     m_source = source;
+
+    if (!m_source) {
+        m_sourceActive.store(false, std::memory_order_relaxed);
+    }
 }
 
 void AudioBuffer::forward()
@@ -135,11 +144,13 @@ void AudioBuffer::forward()
         return;
     }
 
+    m_sourceActive.store(true, std::memory_order_relaxed);
+
     const auto currentWriteIdx = m_writeIndex.load(std::memory_order_relaxed);
     const auto currentReadIdx = m_readIndex.load(std::memory_order_acquire);
     size_t nextWriteIdx = currentWriteIdx;
 
-    samples_t framesToReserve = DEFAULT_SIZE / 2;
+    const size_t framesToReserve = m_renderAhead.load(std::memory_order_relaxed);
 
     while (reservedFrames(nextWriteIdx, currentReadIdx) < framesToReserve) {
         m_source->process(m_data.data() + nextWriteIdx, m_renderStep);
@@ -154,15 +165,23 @@ void AudioBuffer::pop(float* dest, size_t sampleCount)
 {
     const auto currentReadIdx = m_readIndex.load(std::memory_order_relaxed);
     const auto currentWriteIdx = m_writeIndex.load(std::memory_order_acquire);
+    const size_t requestedFrames = sampleCount * m_audioChannelsCount;
+    const bool underrun = reservedFrames(currentWriteIdx, currentReadIdx) < requestedFrames;
+
+    if (m_sourceActive.load(std::memory_order_relaxed)) {
+        adaptRenderAhead(underrun, requestedFrames);
+    }
+
     if (currentReadIdx == currentWriteIdx) { // empty queue
-        std::memcpy(dest, SILENT_FRAMES.data(), sampleCount * sizeof(float) * m_audioChannelsCount);
+        std::memcpy(dest, SILENT_FRAMES.data(), requestedFrames * sizeof(float));
+        requestData();
         return;
     }
 
-    if (reservedFrames(currentWriteIdx, currentReadIdx) < (sampleCount * 2)) {
+    if (underrun) {
         static size_t missingFramesTotal = 0;
-        missingFramesTotal += (sampleCount * 2);
-        LOG_AUDIO() << "\n FRAMES MISSED " << sampleCount * 2 << ", reserve: " <<
+        missingFramesTotal += requestedFrames;
+        LOG_AUDIO() << "\n FRAMES MISSED " << requestedFrames << ", reserve: " <<
             reservedFrames(currentWriteIdx, currentReadIdx) << ", total: " << missingFramesTotal;
     }
 
@@ -189,6 +208,8 @@ void AudioBuffer::pop(float* dest, size_t sampleCount)
     }
 
     m_readIndex.store(newReadIdx, std::memory_order_release);
+
+    requestData();
 }
 
 void AudioBuffer::setMinSamplesToReserve(size_t lag)
@@ -197,6 +218,79 @@ void AudioBuffer::setMinSamplesToReserve(size_t lag)
         lag = DEFAULT_SIZE;
     }
     m_minSamplesToReserve = lag;
+    m_renderAhead.store(minRenderAhead(), std::memory_order_relaxed);
+}
+
+bool AudioBuffer::waitForDataRequest(std::chrono::microseconds timeout)
+{
+    if (!m_dataRequestSemaphore.tryAcquireFor(timeout)) {
+        return false;
+    }
+
+    m_dataRequested.store(false, std::memory_order_release);
+    return true;
+}
+
+AudioBuffer::Stats AudioBuffer::stats() const
+{
+    Stats stats;
+    stats.underruns = m_underrunsCount.load(std::memory_order_relaxed);
+    stats.dataRequests = m_dataRequestsCount.load(std::memory_order_relaxed);
+    stats.renderAheadSamples = m_audioChannelsCount != 0
+                               ? m_renderAhead.load(std::memory_order_relaxed) / m_audioChannelsCount
+                               : 0;
+    return stats;
+}
+
+void AudioBuffer::requestData()
+{
+    if (m_dataRequested.exchange(true, std::memory_order_acq_rel)) {
+        return;
+    }
+
+    m_dataRequestsCount.fetch_add(1, std::memory_order_relaxed);
+
+    //! NOTE The semaphore is released once per request, the flag stays set until the producer has taken it.
+    //! Releasing it never blocks, so the driver callback can't wait for the producer thread
+    m_dataRequestSemaphore.release();
+}
+
+size_t AudioBuffer::minRenderAhead() const
+{
+    //! NOTE Double buffering of the bigger of the driver request and the render step
+    size_t samples = std::max(m_minSamplesToReserve.load(), static_cast<size_t>(m_renderStep));
+    return std::min(samples * m_audioChannelsCount * 2, maxRenderAhead());
+}
+
+size_t AudioBuffer::maxRenderAhead() const
+{
+    return DEFAULT_SIZE / 2;
+}
+
+void AudioBuffer::adaptRenderAhead(bool underrun, size_t requestedFrames)
+{
+    const size_t current = m_renderAhead.load(std::memory_order_relaxed);
+
+    if (underrun) {
+        m_underrunsCount.fetch_add(1, std::memory_order_relaxed);
+        m_stableReadsCount = 0;
+        m_renderAhead.store(std::min(current + requestedFrames, maxRenderAhead()), std::memory_order_relaxed);
+        return;
+    }
+
+    if (++m_stableReadsCount < STABLE_READS_TO_SHRINK) {
+        return;
+    }
+
+    m_stableReadsCount = 0;
+
+    const size_t min = minRenderAhead();
+    const size_t step = m_renderStep * m_audioChannelsCount;
+    if (current > min + step) {
+        m_renderAhead.store(current - step, std::memory_order_relaxed);
+    } else if (current > min) {
+        m_renderAhead.store(min, std::memory_order_relaxed);
+    }
 }
 
 void AudioBuffer::reset()
@@ -25,6 +25,9 @@
 #include <vector>
 #include <memory>
 #include <atomic>
+#include <chrono>
+
+#include "global/concurrency/semaphore.h"
 
 #include "iaudiosource.h"
 #include "audiotypes.h"
@@ -43,6 +46,9 @@ constexpr size_t cache_line_size = 64;
 #endif
 
 namespace mu::audio {
+//! NOTE Single producer (audio worker) / single consumer (driver callback) lock-free ring.
+//! The consumer requests more data after each read, so the producer can sleep until then,
+//! and the amount of data rendered ahead adapts: it grows on underruns and shrinks back while playback is stable
 class AudioBuffer
 {
 public:
@@ -56,13 +62,39 @@ public:
     void pop(float* dest, size_t sampleCount);
     void setMinSamplesToReserve(size_t lag);
 
+    //! NOTE Called by the producer, returns true if data was requested, false on timeout
+    bool waitForDataRequest(std::chrono::microseconds timeout);
+
+    struct Stats {
+        uint64_t underruns = 0;
+        uint64_t dataRequests = 0;
+        size_t renderAheadSamples = 0; // per channel
+    };
+
+    Stats stats() const;
+
     void reset();
 
 private:
     size_t reservedFrames(const size_t writeIdx, const size_t readIdx) const;
     size_t incrementWriteIndex(const size_t writeIdx, const samples_t samplesPerChannel);
 
-    size_t m_minSamplesToReserve = 0;
+    size_t minRenderAhead() const;
+    size_t maxRenderAhead() const;
+    void adaptRenderAhead(bool underrun, size_t requestedFrames);
+    void requestData();
+
+    std::atomic<size_t> m_minSamplesToReserve = 0;
+
+    std::atomic<size_t> m_renderAhead = 0; // frames, all channels
+    std::atomic<bool> m_sourceActive = false;
+    size_t m_stableReadsCount = 0;
+
+    std::atomic<uint64_t> m_underrunsCount = 0;
+    std::atomic<uint64_t> m_dataRequestsCount = 0;
+
+    std::atomic<bool> m_dataRequested = false;
+    Semaphore m_dataRequestSemaphore;
 
     alignas(cache_line_size) std::atomic<size_t> m_writeIndex = 0;
     alignas(cache_line_size) std::atomic<size_t> m_readIndex = 0;
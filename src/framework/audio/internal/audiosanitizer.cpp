@@ -22,6 +22,8 @@
 #include "audiosanitizer.h"
 
 #include <thread>
+#include <mutex>
+#include <set>
 
 #include "concurrency/taskscheduler.h"
 
@@ -29,6 +31,8 @@ using namespace mu::audio;
 
 static std::thread::id s_as_mainThreadID;
 static std::thread::id s_as_workerThreadID;
+static std::set<std::thread::id> s_as_additionalWorkerThreadIDs;
+static std::mutex s_as_additionalWorkerThreadIDsMutex;
 
 void AudioSanitizer::setupMainThread()
 {
@@ -59,5 +63,24 @@ bool AudioSanitizer::isWorkerThread()
 {
     std::thread::id id = std::this_thread::get_id();
 
-    return TaskScheduler::instance()->containsThread(id) || id == s_as_workerThreadID;
+    if (id == s_as_workerThreadID || TaskScheduler::instance()->containsThread(id)) {
+        return true;
+    }
+
+    std::lock_guard lock(s_as_additionalWorkerThreadIDsMutex);
+    return s_as_additionalWorkerThreadIDs.find(id) != s_as_additionalWorkerThreadIDs.cend();
+}
+
+void AudioSanitizer::addWorkerThreads(const std::vector<std::thread::id>& ids)
+{
+    std::lock_guard lock(s_as_additionalWorkerThreadIDsMutex);
+    s_as_additionalWorkerThreadIDs.insert(ids.cbegin(), ids.cend());
+}
+
+void AudioSanitizer::removeWorkerThreads(const std::vector<std::thread::id>& ids)
+{
+    std::lock_guard lock(s_as_additionalWorkerThreadIDsMutex);
+    for (const std::thread::id& id : ids) {
+        s_as_additionalWorkerThreadIDs.erase(id);
+    }
 }
@@ -26,6 +26,7 @@
 
 #include <cassert>
 #include <thread>
+#include <vector>
 
 namespace mu::audio {
 class AudioSanitizer
@@ -39,6 +40,10 @@ public:
     static void setupWorkerThread();
     static std::thread::id workerThread();
     static bool isWorkerThread();
+
+    //! NOTE Threads that process audio on behalf of the worker thread (e.g. mixer pool threads)
+    static void addWorkerThreads(const std::vector<std::thread::id>& ids);
+    static void removeWorkerThreads(const std::vector<std::thread::id>& ids);
 };
 }
 
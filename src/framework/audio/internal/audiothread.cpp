@@ -40,10 +40,11 @@ AudioThread::~AudioThread()
     }
 }
 
-void AudioThread::run(const Runnable& onStart, const Runnable& loopBody)
+void AudioThread::run(const Runnable& onStart, const Runnable& loopBody, const Runnable& waitForWork)
 {
     m_onStart = onStart;
     m_mainLoopBody = loopBody;
+    m_waitForWork = waitForWork;
 
 #ifndef Q_OS_WASM
     m_running = true;
@@ -89,7 +90,11 @@ void AudioThread::main()
             m_mainLoopBody();
         }
 
-        std::this_thread::sleep_for(std::chrono::milliseconds(2));
+        if (m_waitForWork) {
+            m_waitForWork();
+        } else {
+            std::this_thread::sleep_for(std::chrono::milliseconds(2));
+        }
     }
 
     if (m_onFinished) {
@@ -39,7 +39,9 @@ public:
 
     using Runnable = std::function<void ()>;
 
-    void run(const Runnable& onStart, const Runnable& loopBody);
+    //! NOTE If `waitForWork` is set, it is called between iterations instead of sleeping for a fixed interval;
+    //! it must return in a bounded time, as the thread also processes async events between iterations
+    void run(const Runnable& onStart, const Runnable& loopBody, const Runnable& waitForWork = nullptr);
     void stop(const Runnable& onFinished = nullptr);
     bool isRunning() const;
 
@@ -48,6 +50,7 @@ private:
 
     Runnable m_onStart = nullptr;
     Runnable m_mainLoopBody = nullptr;
+    Runnable m_waitForWork = nullptr;
     Runnable m_onFinished = nullptr;
 
     std::unique_ptr<std::thread> m_thread = nullptr;
@@ -69,6 +69,13 @@ public:
     virtual size_t encode(samples_t samplesPerChannel, const float* input) = 0;
     virtual size_t flush() = 0;
 
+    //! NOTE Whether encode() may be called for consecutive parts of the audio
+    //! and produces the same output as for the whole audio at once
+    virtual bool isIncremental() const
+    {
+        return false;
+    }
+
     framework::Progress progress()
     {
         return m_progress;
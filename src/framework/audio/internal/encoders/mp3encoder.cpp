@@ -110,6 +110,12 @@ size_t Mp3Encoder::flush()
     return std::fwrite(m_outputBuffer.data(), sizeof(unsigned char), encodedBytes, m_fileStream);
 }
 
+bool Mp3Encoder::isIncremental() const
+{
+    //! NOTE LAME buffers the input internally until a whole frame is collected
+    return true;
+}
+
 void Mp3Encoder::closeDestination()
 {
     AbstractAudioEncoder::closeDestination();
@@ -36,6 +36,8 @@ public:
     size_t encode(samples_t samplesPerChannel, const float* input) override;
     size_t flush() override;
 
+    bool isIncremental() const override;
+
 private:
     size_t requiredOutputBufferSize(samples_t totalSamplesNumber) const override;
     void closeDestination() override;
@@ -0,0 +1,169 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2023 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef MU_AUDIO_EVENTTIMELINE_H
+#define MU_AUDIO_EVENTTIMELINE_H
+
+#include <algorithm>
+#include <utility>
+#include <vector>
+
+#include "../audiotypes.h"
+
+namespace mu::audio {
+//! NOTE A flat timeline of the sequencer events: a single vector of (timestamp, event) entries
+//! sorted by timestamp and then by event, without duplicates.
+//! Unlike std::map<msecs_t, std::set<Event>> it keeps all the events in one contiguous block,
+//! so that seeking is a binary search and the dispatching of a block is a linear scan.
+//!
+//! Events are collected with add() in any order, finalize() has to be called before the timeline is read
+template<typename EventType>
+class EventTimeline
+{
+public:
+    struct Entry {
+        msecs_t timestamp = 0;
+        EventType event;
+
+        bool operator<(const Entry& other) const
+        {
+            if (timestamp != other.timestamp) {
+                return timestamp < other.timestamp;
+            }
+
+            return event < other.event;
+        }
+
+        bool operator==(const Entry& other) const
+        {
+            return timestamp == other.timestamp && !(event < other.event) && !(other.event < event);
+        }
+    };
+
+    using Entries = std::vector<Entry>;
+    using const_iterator = typename Entries::const_iterator;
+
+    void add(const msecs_t timestamp, const EventType& event)
+    {
+        m_entries.push_back({ timestamp, event });
+        m_isSorted = false;
+    }
+
+    void add(const msecs_t timestamp, EventType&& event)
+    {
+        m_entries.push_back({ timestamp, std::move(event) });
+        m_isSorted = false;
+    }
+
+    void finalize()
+    {
+        if (m_isSorted) {
+            return;
+        }
+
+        std::sort(m_entries.begin(), m_entries.end());
+        m_entries.erase(std::unique(m_entries.begin(), m_entries.end()), m_entries.end());
+        m_isSorted = true;
+    }
+
+    bool isFinalized() const
+    {
+        return m_isSorted;
+    }
+
+    void reserve(const size_t size)
+    {
+        m_entries.reserve(size);
+    }
+
+    void clear()
+    {
+        m_entries.clear();
+        m_isSorted = true;
+    }
+
+    bool empty() const
+    {
+        return m_entries.empty();
+    }
+
+    size_t size() const
+    {
+        return m_entries.size();
+    }
+
+    const Entry& at(const size_t idx) const
+    {
+        return m_entries[idx];
+    }
+
+    const_iterator begin() const
+    {
+        return m_entries.cbegin();
+    }
+
+    const_iterator end() const
+    {
+        return m_entries.cend();
+    }
+
+    //! Index of the first entry with timestamp >= the given one
+    size_t lowerBound(const msecs_t timestamp) const
+    {
+        auto it = std::lower_bound(m_entries.cbegin(), m_entries.cend(), timestamp, [](const Entry& entry, const msecs_t value) {
+            return entry.timestamp < value;
+        });
+
+        return static_cast<size_t>(std::distance(m_entries.cbegin(), it));
+    }
+
+    //! Index of the first entry with timestamp > the given one
+    size_t upperBound(const msecs_t timestamp) const
+    {
+        auto it = std::upper_bound(m_entries.cbegin(), m_entries.cend(), timestamp, [](const msecs_t value, const Entry& entry) {
+            return value < entry.timestamp;
+        });
+
+        return static_cast<size_t>(std::distance(m_entries.cbegin(), it));
+    }
+
+    //! Replaces all the entries within [from, to] by the entries of the source within the same range.
+    //! Both timelines have to be finalized
+    void replace(const msecs_t from, const msecs_t to, const EventTimeline& source)
+    {
+        auto first = m_entries.begin() + lowerBound(from);
+        auto last = m_entries.begin() + upperBound(to);
+
+        auto sourceFirst = source.m_entries.cbegin() + source.lowerBound(from);
+        auto sourceLast = source.m_entries.cbegin() + source.upperBound(to);
+
+        first = m_entries.erase(first, last);
+        m_entries.insert(first, sourceFirst, sourceLast);
+    }
+
+private:
+    Entries m_entries;
+    bool m_isSorted = true;
+};
+}
+
+#endif // MU_AUDIO_EVENTTIMELINE_H
@@ -22,6 +22,9 @@
 
 #include "soundtrackwriter.h"
 
+#include <chrono>
+#include <thread>
+
 #include "internal/worker/audioengine.h"
 #include "internal/encoders/mp3encoder.h"
 #include "internal/encoders/oggencoder.h"
@@ -39,6 +42,9 @@ using namespace mu::audio::soundtrack;
 static constexpr int PREPARE_STEP = 0;
 static constexpr int ENCODE_STEP = 1;
 
+//! NOTE The encoding thread waits for at least this number of render steps before encoding them
+static constexpr size_t ENCODE_CHUNK_RENDER_STEPS = 16;
+
 SoundTrackWriter::SoundTrackWriter(const io::path_t& destination, const SoundTrackFormat& format, const msecs_t totalDuration,
                                    IAudioSourcePtr source)
     : m_source(std::move(source))
@@ -87,12 +93,44 @@ Ret SoundTrackWriter::write()
         m_isAborted = false;
     };
 
+    samples_t totalSamplesPerChannel = m_inputBuffer.size() / sizeof(float);
+    size_t bytes = 0;
+
+    auto startTime = std::chrono::steady_clock::now();
+
+    //! NOTE If the encoder is able to encode the audio in parts, it runs on a separate thread
+    //! and encodes everything that has been rendered so far, while the rendering goes on
+    std::thread encodingThread;
+    if (m_encoderPtr->isIncremental()) {
+        // the progress is reported by the rendering only
+        m_encoderPtr->progress().progressChanged.resetOnReceive(this);
+
+        setRenderedOffset(0, false);
+        encodingThread = std::thread([this, totalSamplesPerChannel, &bytes]() {
+            bytes = encodeRenderedData(totalSamplesPerChannel);
+        });
+    }
+
     Ret ret = generateAudioData();
+
+    if (encodingThread.joinable()) {
+        setRenderedOffset(m_renderedOffset, true);
+        encodingThread.join();
+    }
+
     if (!ret) {
         return ret;
     }
 
-    size_t bytes = m_encoderPtr->encode(m_inputBuffer.size() / sizeof(float), m_inputBuffer.data());
+    if (!m_encoderPtr->isIncremental()) {
+        bytes = m_encoderPtr->encode(totalSamplesPerChannel, m_inputBuffer.data());
+    }
+
+    std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - startTime;
+    double audioSecs = static_cast<double>(totalSamplesPerChannel) / m_encoderPtr->format().sampleRate;
+
+    LOGI() << "Exported " << audioSecs << " s of audio in " << elapsed.count() << " s"
+           << " (" << (elapsed.count() > 0 ? audioSecs / elapsed.count() : 0.0) << "x realtime)";
 
     if (m_isAborted) {
         return make_ret(Ret::Code::Cancel);
@@ -150,6 +188,7 @@ Ret SoundTrackWriter::generateAudioData()
                   m_inputBuffer.begin() + inputBufferOffset);
 
         inputBufferOffset += samplesToCopy;
+        setRenderedOffset(inputBufferOffset, false);
         sendStepProgress(PREPARE_STEP, inputBufferOffset, inputBufferMaxOffset);
     }
 
@@ -165,6 +204,57 @@ Ret SoundTrackWriter::generateAudioData()
     return make_ok();
 }
 
+void SoundTrackWriter::setRenderedOffset(size_t offset, bool finished)
+{
+    {
+        std::lock_guard lock(m_renderedMutex);
+        m_renderedOffset = offset;
+        m_renderingFinished = finished;
+    }
+
+    m_renderedChanged.notify_one();
+}
+
+size_t SoundTrackWriter::encodeRenderedData(samples_t totalSamplesPerChannel)
+{
+    const audioch_t channels = m_encoderPtr->format().audioChannelsNumber;
+    const size_t totalSamples = std::min(static_cast<size_t>(totalSamplesPerChannel) * channels, m_inputBuffer.size());
+    const size_t chunkSamples = static_cast<size_t>(config()->renderStep()) * channels * ENCODE_CHUNK_RENDER_STEPS;
+
+    size_t encodedOffset = 0;
+    size_t bytes = 0;
+
+    while (encodedOffset < totalSamples && !m_isAborted) {
+        size_t renderedOffset = 0;
+        bool finished = false;
+
+        {
+            std::unique_lock lock(m_renderedMutex);
+            m_renderedChanged.wait(lock, [this, encodedOffset, chunkSamples]() {
+                return m_renderingFinished || m_renderedOffset >= encodedOffset + chunkSamples;
+            });
+
+            renderedOffset = m_renderedOffset;
+            finished = m_renderingFinished;
+        }
+
+        renderedOffset = std::min(renderedOffset, totalSamples);
+
+        // only whole frames are encoded, the rest is waiting for the next chunk
+        samples_t samplesPerChannel = (renderedOffset - encodedOffset) / channels;
+        if (samplesPerChannel > 0 && !m_isAborted) {
+            bytes += m_encoderPtr->encode(samplesPerChannel, m_inputBuffer.data() + encodedOffset);
+            encodedOffset += static_cast<size_t>(samplesPerChannel) * channels;
+        }
+
+        if (finished) {
+            break;
+        }
+    }
+
+    return bytes;
+}
+
 void SoundTrackWriter::sendStepProgress(int step, int64_t current, int64_t total)
 {
     int stepRange = step == PREPARE_STEP ? 80 : 20;
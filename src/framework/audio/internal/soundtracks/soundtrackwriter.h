@@ -25,6 +25,8 @@
 
 #include <vector>
 #include <cstdio>
+#include <mutex>
+#include <condition_variable>
 
 #include "async/asyncable.h"
 #include "modularity/ioc.h"
@@ -50,6 +52,9 @@ private:
     encode::AbstractAudioEncoderPtr createEncoder(const SoundTrackType& type) const;
     Ret generateAudioData();
 
+    void setRenderedOffset(size_t offset, bool finished);
+    size_t encodeRenderedData(samples_t totalSamplesPerChannel);
+
     void sendStepProgress(int step, int64_t current, int64_t total);
 
     IAudioSourcePtr m_source = nullptr;
@@ -61,6 +66,12 @@ private:
 
     framework::Progress m_progress;
     std::atomic<bool> m_isAborted = false;
+
+    //! NOTE The rendered part of m_inputBuffer, which the encoding thread may consume
+    std::mutex m_renderedMutex;
+    std::condition_variable m_renderedChanged;
+    size_t m_renderedOffset = 0;
+    bool m_renderingFinished = false;
 };
 }
 
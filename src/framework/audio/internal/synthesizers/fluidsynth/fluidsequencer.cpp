@@ -66,6 +66,13 @@ void FluidSequencer::updateMainStreamEvents(const mpe::PlaybackEventsMap& change
     updateMainSequenceIterator();
 }
 
+void FluidSequencer::applyMainStreamDelta(const mpe::PlaybackEventsDelta& delta)
+{
+    applyMainStreamDeltaPartially(delta, [this](Timeline& destination, const mpe::PlaybackEventsMap& events) {
+        updatePlaybackEvents(destination, events);
+    });
+}
+
 void FluidSequencer::updateDynamicChanges(const mpe::DynamicLevelMap& changes)
 {
     m_dynamicEvents.clear();
@@ -75,7 +82,7 @@ void FluidSequencer::updateDynamicChanges(const mpe::DynamicLevelMap& changes)
         event.setIndex(midi::EXPRESSION_CONTROLLER);
         event.setData(expressionLevel(pair.second));
 
-        m_dynamicEvents[pair.first].emplace(std::move(event));
+        m_dynamicEvents.add(pair.first, std::move(event));
     }
 
     updateDynamicChangesIterator();
@@ -91,7 +98,7 @@ const ChannelMap& FluidSequencer::channels() const
     return m_channels;
 }
 
-void FluidSequencer::updatePlaybackEvents(EventSequenceMap& destination, const mpe::PlaybackEventsMap& changes)
+void FluidSequencer::updatePlaybackEvents(Timeline& destination, const mpe::PlaybackEventsMap& changes)
 {
     for (const auto& pair : changes) {
         for (const mpe::PlaybackEvent& event : pair.second) {
@@ -115,14 +122,14 @@ void FluidSequencer::updatePlaybackEvents(EventSequenceMap& destination, const m
             noteOn.setVelocity(velocity);
             noteOn.setPitchNote(noteIdx, tuning);
 
-            destination[timestampFrom].emplace(std::move(noteOn));
+            destination.add(timestampFrom, std::move(noteOn));
 
             midi::Event noteOff(Event::Opcode::NoteOff, Event::MessageType::ChannelVoice20);
             noteOff.setChannel(channelIdx);
             noteOff.setNote(noteIdx);
             noteOff.setPitchNote(noteIdx, tuning);
 
-            destination[timestampTo].emplace(std::move(noteOff));
+            destination.add(timestampTo, std::move(noteOff));
 
             appendControlSwitch(destination, noteEvent, PEDAL_CC_SUPPORTED_TYPES, 64);
             appendPitchBend(destination, noteEvent, BEND_SUPPORTED_TYPES, channelIdx);
@@ -130,7 +137,7 @@ void FluidSequencer::updatePlaybackEvents(EventSequenceMap& destination, const m
     }
 }
 
-void FluidSequencer::appendControlSwitch(EventSequenceMap& destination, const mpe::NoteEvent& noteEvent,
+void FluidSequencer::appendControlSwitch(Timeline& destination, const mpe::NoteEvent& noteEvent,
                                          const mpe::ArticulationTypeSet& appliableTypes, const int midiControlIdx)
 {
     mpe::ArticulationType currentType = mpe::ArticulationType::Undefined;
@@ -150,23 +157,23 @@ void FluidSequencer::appendControlSwitch(EventSequenceMap& destination, const mp
         start.setIndex(midiControlIdx);
         start.setData(127);
 
-        destination[noteEvent.arrangementCtx().actualTimestamp].emplace(std::move(start));
+        destination.add(noteEvent.arrangementCtx().actualTimestamp, std::move(start));
 
         midi::Event end(Event::Opcode::ControlChange, Event::MessageType::ChannelVoice10);
         end.setIndex(midiControlIdx);
         end.setData(0);
 
-        destination[articulationMeta.timestamp + articulationMeta.overallDuration].emplace(std::move(end));
+        destination.add(articulationMeta.timestamp + articulationMeta.overallDuration, std::move(end));
     } else {
         midi::Event cc(Event::Opcode::ControlChange, Event::MessageType::ChannelVoice10);
         cc.setIndex(midiControlIdx);
         cc.setData(0);
 
-        destination[noteEvent.arrangementCtx().actualTimestamp].emplace(std::move(cc));
+        destination.add(noteEvent.arrangementCtx().actualTimestamp, std::move(cc));
     }
 }
 
-void FluidSequencer::appendPitchBend(EventSequenceMap& destination, const mpe::NoteEvent& noteEvent,
+void FluidSequencer::appendPitchBend(Timeline& destination, const mpe::NoteEvent& noteEvent,
                                      const mpe::ArticulationTypeSet& appliableTypes, const channel_t channelIdx)
 {
     mpe::ArticulationType currentType = mpe::ArticulationType::Undefined;
@@ -195,7 +202,7 @@ void FluidSequencer::appendPitchBend(EventSequenceMap& destination, const mpe::N
                 timestamp_t currentPoint = timestampFrom + noteEvent.arrangementCtx().actualDuration * percentageToFactor(it->first);
 
                 event.setData(pitchBendLevel(it->second));
-                destination[currentPoint].emplace(event);
+                destination.add(currentPoint, event);
                 return;
             }
 
@@ -216,7 +223,7 @@ void FluidSequencer::appendPitchBend(EventSequenceMap& destination, const mpe::N
 
                 int pitchBendVal = pitchBendLevel(it->second + (i * pitchStep));
                 event.setData(pitchBendVal);
-                destination[currentPoint].emplace(event);
+                destination.add(currentPoint, event);
             }
 
             it++;
@@ -226,7 +233,7 @@ void FluidSequencer::appendPitchBend(EventSequenceMap& destination, const mpe::N
     }
 
     event.setData(8192);
-    destination[timestampFrom].emplace(std::move(event));
+    destination.add(timestampFrom, std::move(event));
 }
 
 channel_t FluidSequencer::channel(const mpe::NoteEvent& noteEvent) const
@@ -332,24 +332,53 @@ samples_t FluidSynth::process(float* buffer, samples_t samplesPerChannel)
     }
 
     msecs_t nextMsecs = samplesToMsecs(samplesPerChannel, m_sampleRate);
-    FluidSequencer::EventSequence sequence = m_sequencer.eventsToBePlayed(nextMsecs);
+    const FluidSequencer::EventSequence& sequence = m_sequencer.eventsToBePlayed(nextMsecs);
+    const std::vector<msecs_t>& offsets = m_sequencer.eventOffsets();
+
+    auto eventSample = [this, &offsets, samplesPerChannel](const size_t idx) {
+        return std::min(microSecsToSamples(offsets.at(idx), m_sampleRate), samplesPerChannel);
+    };
+
+    auto render = [this, buffer](const samples_t from, const samples_t count) {
+        const int offset = static_cast<int>(from * FLUID_AUDIO_CHANNELS_COUNT);
+
+        return fluid_synth_write_float(m_fluid->synth, static_cast<int>(count),
+                                       buffer, offset, FLUID_AUDIO_CHANNELS_COUNT,
+                                       buffer, offset + 1, FLUID_AUDIO_CHANNELS_COUNT) == FLUID_OK;
+    };
+
+    //! NOTE The block is rendered in parts, split at the sample offsets of the events,
+    //! so the events sound where they are due instead of at the start of the block
+    samples_t renderedSamples = 0;
+    size_t eventIdx = 0;
+
+    while (eventIdx < sequence.size()) {
+        const samples_t splitSample = eventSample(eventIdx);
+        if (splitSample > renderedSamples) {
+            if (!render(renderedSamples, splitSample - renderedSamples)) {
+                return 0;
+            }
+
+            renderedSamples = splitSample;
+        }
 
-    if (!sequence.empty()) {
         m_tuning.reset();
-    }
 
-    for (const FluidSequencer::EventType& event : sequence) {
-        handleEvent(std::get<midi::Event>(event));
-    }
+        for (; eventIdx < sequence.size() && eventSample(eventIdx) <= renderedSamples; ++eventIdx) {
+            handleEvent(std::get<midi::Event>(sequence.at(eventIdx)));
+        }
 
-    fluid_synth_tune_notes(m_fluid->synth, 0, 0, m_tuning.size(), m_tuning.keys.data(), m_tuning.pitches.data(), true);
+        fluid_synth_tune_notes(m_fluid->synth, 0, 0, m_tuning.size(), m_tuning.keys.data(), m_tuning.pitches.data(), true);
+    }
 
-    int result = fluid_synth_write_float(m_fluid->synth, samplesPerChannel,
-                                         buffer, 0, FLUID_AUDIO_CHANNELS_COUNT,
-                                         buffer, 1, FLUID_AUDIO_CHANNELS_COUNT);
+    if (sequence.empty()) {
+        fluid_synth_tune_notes(m_fluid->synth, 0, 0, m_tuning.size(), m_tuning.keys.data(), m_tuning.pitches.data(), true);
+    }
 
-    if (result != FLUID_OK) {
-        return 0;
+    if (renderedSamples < samplesPerChannel) {
+        if (!render(renderedSamples, samplesPerChannel - renderedSamples)) {
+            return 0;
+        }
     }
 
     return samplesPerChannel;
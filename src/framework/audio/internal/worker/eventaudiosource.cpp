@@ -45,6 +45,10 @@ EventAudioSource::EventAudioSource(const TrackId trackId, const mpe::PlaybackDat
         m_playbackData.originEvents = events;
     });
 
+    m_playbackData.mainStreamDelta.onReceive(this, [this](const PlaybackEventsDelta& delta) {
+        applyPlaybackEventsDelta(m_playbackData.originEvents, delta);
+    });
+
     m_playbackData.dynamicLevelChanges.onReceive(this, [this](const DynamicLevelMap& changes) {
         m_playbackData.dynamicLevelMap = changes;
     });
@@ -54,6 +58,7 @@ EventAudioSource::~EventAudioSource()
 {
     m_playbackData.offStream.resetOnReceive(this);
     m_playbackData.mainStream.resetOnReceive(this);
+    m_playbackData.mainStreamDelta.resetOnReceive(this);
     m_playbackData.dynamicLevelChanges.resetOnReceive(this);
 }
 
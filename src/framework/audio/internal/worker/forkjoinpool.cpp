@@ -0,0 +1,183 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2023 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include "forkjoinpool.h"
+
+#include "log.h"
+
+using namespace mu::audio;
+
+static constexpr uint64_t FIELD_MASK = 0xFFFFFF;
+static constexpr int COUNT_SHIFT = 24;
+static constexpr int GENERATION_SHIFT = 48;
+static constexpr uint64_t GENERATION_MASK = 0xFFFF;
+
+//! NOTE How many times a pool thread checks for new work before going to sleep.
+//! Between two consecutive runs of the same audio callback the threads usually keep spinning,
+//! so there is no need to wake them up through the OS
+static constexpr int SPIN_COUNT = 256;
+
+static inline size_t nextIndex(uint64_t state)
+{
+    return static_cast<size_t>(state & FIELD_MASK);
+}
+
+static inline size_t taskCount(uint64_t state)
+{
+    return static_cast<size_t>((state >> COUNT_SHIFT) & FIELD_MASK);
+}
+
+static inline uint64_t generation(uint64_t state)
+{
+    return (state >> GENERATION_SHIFT) & GENERATION_MASK;
+}
+
+ForkJoinPool::ForkJoinPool(size_t threadCount)
+{
+    m_running = true;
+
+    m_workers.reserve(threadCount);
+    for (size_t i = 0; i < threadCount; ++i) {
+        m_workers.push_back(std::make_unique<Worker>());
+    }
+
+    for (std::unique_ptr<Worker>& worker : m_workers) {
+        worker->thread = std::thread(&ForkJoinPool::workerLoop, this, worker.get());
+    }
+}
+
+ForkJoinPool::~ForkJoinPool()
+{
+    m_running = false;
+
+    wakeUpWorkers();
+
+    for (std::unique_ptr<Worker>& worker : m_workers) {
+        worker->thread.join();
+    }
+}
+
+size_t ForkJoinPool::threadCount() const
+{
+    return m_workers.size();
+}
+
+std::vector<std::thread::id> ForkJoinPool::threadIds() const
+{
+    std::vector<std::thread::id> result;
+    result.reserve(m_workers.size());
+
+    for (const std::unique_ptr<Worker>& worker : m_workers) {
+        result.push_back(worker->thread.get_id());
+    }
+
+    return result;
+}
+
+void ForkJoinPool::dispatch(size_t count)
+{
+    IF_ASSERT_FAILED(count <= FIELD_MASK) {
+        return;
+    }
+
+    m_remaining.store(count, std::memory_order_relaxed);
+
+    uint64_t newGeneration = (generation(m_state.load(std::memory_order_relaxed)) + 1) & GENERATION_MASK;
+    uint64_t newState = (newGeneration << GENERATION_SHIFT) | (static_cast<uint64_t>(count) << COUNT_SHIFT);
+
+    m_state.store(newState, std::memory_order_seq_cst);
+
+    wakeUpWorkers();
+
+    processTasks();
+
+    while (m_remaining.load(std::memory_order_acquire) != 0) {
+        std::this_thread::yield();
+    }
+}
+
+void ForkJoinPool::wakeUpWorkers()
+{
+    //! NOTE Pairs with the sleeping flag set in workerLoop(): either the thread sees the new state
+    //! (or m_running) before it parks, or the flag is seen here and the thread is woken up
+    for (std::unique_ptr<Worker>& worker : m_workers) {
+        if (worker->sleeping.exchange(false, std::memory_order_seq_cst)) {
+            worker->wakeup.release();
+        }
+    }
+}
+
+void ForkJoinPool::processTasks()
+{
+    uint64_t state = m_state.load(std::memory_order_acquire);
+
+    while (nextIndex(state) < taskCount(state)) {
+        if (!m_state.compare_exchange_weak(state, state + 1, std::memory_order_acq_rel, std::memory_order_acquire)) {
+            continue;
+        }
+
+        //! NOTE The run can't be finished (and m_invoke/m_context can't be replaced)
+        //! until the task taken here is completed
+        m_invoke(m_context, nextIndex(state));
+        m_remaining.fetch_sub(1, std::memory_order_acq_rel);
+
+        state = m_state.load(std::memory_order_acquire);
+    }
+}
+
+void ForkJoinPool::workerLoop(Worker* worker)
+{
+    uint64_t lastGeneration = generation(m_state.load(std::memory_order_acquire));
+
+    auto hasNewWork = [this, &lastGeneration]() {
+        return generation(m_state.load(std::memory_order_acquire)) != lastGeneration;
+    };
+
+    while (m_running) {
+        bool woken = false;
+        for (int i = 0; i < SPIN_COUNT && m_running; ++i) {
+            if (hasNewWork()) {
+                woken = true;
+                break;
+            }
+
+            std::this_thread::yield();
+        }
+
+        if (!woken) {
+            worker->sleeping.store(true, std::memory_order_seq_cst);
+
+            if (m_running && generation(m_state.load(std::memory_order_seq_cst)) == lastGeneration) {
+                worker->wakeup.acquire();
+            } else if (!worker->sleeping.exchange(false, std::memory_order_seq_cst)) {
+                //! NOTE The flag was taken by wakeUpWorkers(), consume its release
+                worker->wakeup.acquire();
+            }
+        }
+
+        if (!m_running) {
+            return;
+        }
+
+        lastGeneration = generation(m_state.load(std::memory_order_acquire));
+        processTasks();
+    }
+}
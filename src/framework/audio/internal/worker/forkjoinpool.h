@@ -0,0 +1,104 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2023 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#ifndef MU_AUDIO_FORKJOINPOOL_H
+#define MU_AUDIO_FORKJOINPOOL_H
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "global/concurrency/semaphore.h"
+
+namespace mu::audio {
+//! NOTE A small fork/join pool for the audio worker thread.
+//! Unlike TaskScheduler it has no task queue: a call of run() publishes a range of indices,
+//! the pool threads and the calling thread take them one by one, and run() returns when
+//! all of them are processed. Nothing is allocated and no std::function/std::future is created
+//! per call, so it can be used from the audio callback.
+class ForkJoinPool
+{
+public:
+    explicit ForkJoinPool(size_t threadCount);
+    ~ForkJoinPool();
+
+    ForkJoinPool(const ForkJoinPool&) = delete;
+    ForkJoinPool& operator=(const ForkJoinPool&) = delete;
+
+    size_t threadCount() const;
+    std::vector<std::thread::id> threadIds() const;
+
+    //! Calls func(index) for every index in [0, count) and waits for all calls to complete
+    template<typename Func>
+    void run(size_t count, Func& func)
+    {
+        if (count == 0) {
+            return;
+        }
+
+        if (m_workers.empty() || count == 1) {
+            for (size_t i = 0; i < count; ++i) {
+                func(i);
+            }
+            return;
+        }
+
+        m_context = &func;
+        m_invoke = [](void* context, size_t index) {
+            (*static_cast<Func*>(context))(index);
+        };
+
+        dispatch(count);
+    }
+
+private:
+    using InvokeFunc = void (*)(void* context, size_t index);
+
+    //! NOTE Each thread parks on its own semaphore, so waking it up never takes a lock
+    struct Worker {
+        std::thread thread;
+        std::atomic<bool> sleeping = false;
+        Semaphore wakeup;
+    };
+
+    void dispatch(size_t count);
+    void processTasks();
+    void workerLoop(Worker* worker);
+    void wakeUpWorkers();
+
+    //! NOTE The state of the current run is packed into a single atomic, so that
+    //! an index can never be taken for a run it does not belong to:
+    //! [generation: 16 bits][count: 24 bits][next index: 24 bits]
+    std::atomic<uint64_t> m_state = 0;
+    std::atomic<size_t> m_remaining = 0;
+
+    void* m_context = nullptr;
+    InvokeFunc m_invoke = nullptr;
+
+    std::atomic<bool> m_running = false;
+
+    std::vector<std::unique_ptr<Worker> > m_workers;
+};
+}
+
+#endif // MU_AUDIO_FORKJOINPOOL_H
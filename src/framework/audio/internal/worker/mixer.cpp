@@ -26,7 +26,7 @@
 
 #include <limits>
 
-#include "concurrency/taskscheduler.h"
+#include <thread>
 
 #include "internal/audiosanitizer.h"
 #include "internal/audiothread.h"
@@ -44,11 +44,20 @@ Mixer::Mixer()
     ONLY_AUDIO_WORKER_THREAD;
 
     m_minTrackCountForMultithreading = configuration()->minTrackCountForMultithreading();
+
+    //! NOTE The calling (audio worker) thread takes part in the processing too
+    size_t hardwareThreads = std::thread::hardware_concurrency();
+    size_t poolThreads = hardwareThreads > 2 ? hardwareThreads / 2 - 1 : 0;
+
+    m_processingPool = std::make_unique<ForkJoinPool>(poolThreads);
+    AudioSanitizer::addWorkerThreads(m_processingPool->threadIds());
 }
 
 Mixer::~Mixer()
 {
     ONLY_AUDIO_WORKER_THREAD;
+
+    AudioSanitizer::removeWorkerThreads(m_processingPool->threadIds());
 }
 
 IAudioSourcePtr Mixer::mixedSource()
@@ -70,6 +79,7 @@ RetVal<MixerChannelPtr> Mixer::addChannel(const TrackId trackId, IAudioSourcePtr
     }
 
     m_trackChannels.emplace(trackId, std::make_shared<MixerChannel>(trackId, std::move(source), m_sampleRate));
+    rebuildTrackChannelsData();
 
     result.val = m_trackChannels[trackId];
     result.ret = make_ret(Ret::Code::Ok);
@@ -104,6 +114,7 @@ Ret Mixer::removeChannel(const TrackId trackId)
 
     if (search != m_trackChannels.end() && search->second) {
         m_trackChannels.erase(trackId);
+        rebuildTrackChannelsData();
         return make_ret(Ret::Code::Ok);
     }
 
@@ -161,18 +172,21 @@ samples_t Mixer::process(float* outBuffer, samples_t samplesPerChannel)
         return 0;
     }
 
-    TracksData tracksData;
-    processTrackChannels(outBufferSize, samplesPerChannel, tracksData);
+    processTrackChannels(outBufferSize, samplesPerChannel);
 
     prepareAuxBuffers(outBufferSize);
 
     samples_t masterChannelSampleCount = 0;
 
-    for (auto& pair : tracksData) {
-        const std::vector<float>& trackBuffer = pair.second;
+    for (const TrackChannelData& data : m_trackChannelsData) {
+        if (!data.processed) {
+            continue;
+        }
+
+        const float* trackBuffer = data.buffer.data();
 
         bool outBufferIsSilent = false;
-        mixOutputFromChannel(outBuffer, trackBuffer.data(), samplesPerChannel, outBufferIsSilent);
+        mixOutputFromChannel(outBuffer, trackBuffer, samplesPerChannel, outBufferIsSilent);
         masterChannelSampleCount = std::max(samplesPerChannel, masterChannelSampleCount);
 
         if (!outBufferIsSilent) {
@@ -181,8 +195,8 @@ samples_t Mixer::process(float* outBuffer, samples_t samplesPerChannel)
             continue;
         }
 
-        const AuxSendsParams& auxSends = m_trackChannels.at(pair.first)->outputParams().auxSends;
-        writeTrackToAuxBuffers(trackBuffer.data(), auxSends, samplesPerChannel);
+        const AuxSendsParams& auxSends = data.channel->outputParams().auxSends;
+        writeTrackToAuxBuffers(trackBuffer, auxSends, samplesPerChannel);
     }
 
     if (m_masterParams.muted || masterChannelSampleCount == 0 || m_isSilence) {
@@ -202,51 +216,66 @@ samples_t Mixer::process(float* outBuffer, samples_t samplesPerChannel)
     return masterChannelSampleCount;
 }
 
-void Mixer::processTrackChannels(size_t outBufferSize, size_t samplesPerChannel, TracksData& outTracksData)
+void Mixer::rebuildTrackChannelsData()
 {
-    auto processChannel = [outBufferSize, samplesPerChannel](MixerChannelPtr channel) -> std::vector<float> {
-        thread_local std::vector<float> buffer(outBufferSize, 0.f);
-        thread_local std::vector<float> silent_buffer(outBufferSize, 0.f);
+    std::vector<TrackChannelData> data;
+    data.reserve(m_trackChannels.size());
 
-        buffer = silent_buffer;
+    for (const auto& pair : m_trackChannels) {
+        TrackChannelData channelData;
+        channelData.trackId = pair.first;
+        channelData.channel = pair.second;
+        channelData.buffer.resize(m_writeCacheBuff.size(), 0.f);
 
-        if (channel) {
-            channel->process(buffer.data(), samplesPerChannel);
-        }
+        data.push_back(std::move(channelData));
+    }
 
-        return buffer;
-    };
+    m_trackChannelsData = std::move(data);
+}
 
-    bool filterTracks = m_isIdle && !m_tracksToProcessWhenIdle.empty();
+void Mixer::processTrackChannels(size_t outBufferSize, samples_t samplesPerChannel)
+{
+    for (TrackChannelData& data : m_trackChannelsData) {
+        data.processed = false;
 
-    if (useMultithreading()) {
-        std::map<TrackId, std::future<std::vector<float> > > futures;
+        if (data.buffer.size() != outBufferSize) {
+            data.buffer.resize(outBufferSize, 0.f);
+        }
+    }
 
-        for (const auto& pair : m_trackChannels) {
-            if (filterTracks && !mu::contains(m_tracksToProcessWhenIdle, pair.second->trackId())) {
-                continue;
-            }
+    bool filterTracks = m_isIdle && !m_tracksToProcessWhenIdle.empty();
+
+    auto processChannel = [this, samplesPerChannel, filterTracks](size_t index) {
+        TrackChannelData& data = m_trackChannelsData[index];
 
-            std::future<std::vector<float> > future = TaskScheduler::instance()->submit(processChannel, pair.second);
-            futures.emplace(pair.first, std::move(future));
+        if (filterTracks && !mu::contains(m_tracksToProcessWhenIdle, data.trackId)) {
+            return;
         }
 
-        for (auto& pair : futures) {
-            outTracksData.emplace(pair.first, pair.second.get());
+        std::fill(data.buffer.begin(), data.buffer.end(), 0.f);
+
+        if (data.channel) {
+            data.channel->process(data.buffer.data(), samplesPerChannel);
         }
-    } else {
-        for (const auto& pair : m_trackChannels) {
-            if (filterTracks && !mu::contains(m_tracksToProcessWhenIdle, pair.second->trackId())) {
-                continue;
-            }
 
-            outTracksData.emplace(pair.first, processChannel(pair.second));
+        data.processed = true;
+    };
+
+    if (useMultithreading()) {
+        m_processingPool->run(m_trackChannelsData.size(), processChannel);
+    } else {
+        for (size_t i = 0; i < m_trackChannelsData.size(); ++i) {
+            processChannel(i);
         }
     }
 }
 
 bool Mixer::useMultithreading() const
 {
+    if (m_isOffline) {
+        return m_trackChannels.size() > 1;
+    }
+
     if (m_trackChannels.size() < m_minTrackCountForMultithreading) {
         return false;
     }
@@ -367,6 +396,13 @@ void Mixer::setIsIdle(bool idle)
     m_tracksToProcessWhenIdle.clear();
 }
 
+void Mixer::setIsOffline(bool offline)
+{
+    ONLY_AUDIO_WORKER_THREAD;
+
+    m_isOffline = offline;
+}
+
 void Mixer::setTracksToProcessWhenIdle(std::unordered_set<TrackId>&& trackIds)
 {
     ONLY_AUDIO_WORKER_THREAD;
@@ -31,6 +31,7 @@
 
 #include "abstractaudiosource.h"
 #include "mixerchannel.h"
+#include "forkjoinpool.h"
 #include "internal/dsp/limiter.h"
 #include "ifxresolver.h"
 #include "iaudioconfiguration.h"
@@ -64,6 +65,10 @@ public:
     async::Channel<audioch_t, AudioSignalVal> masterAudioSignalChanges() const;
 
     void setIsIdle(bool idle);
+
+    //! NOTE In the offline mode nothing is waiting for the output,
+    //! so the tracks are processed in parallel whenever there are several of them
+    void setIsOffline(bool offline);
     void setTracksToProcessWhenIdle(std::unordered_set<TrackId>&& trackIds);
 
     // IAudioSource
@@ -73,9 +78,16 @@ public:
     void setIsActive(bool arg) override;
 
 private:
-    using TracksData = std::map<TrackId, std::vector<float> >;
+    //! NOTE Preallocated per-channel data, so that nothing is allocated in the audio callback
+    struct TrackChannelData {
+        TrackId trackId = -1;
+        MixerChannelPtr channel;
+        std::vector<float> buffer;
+        bool processed = false;
+    };
 
-    void processTrackChannels(size_t outBufferSize, size_t samplesPerChannel, TracksData& outTracksData);
+    void rebuildTrackChannelsData();
+    void processTrackChannels(size_t outBufferSize, samples_t samplesPerChannel);
     void mixOutputFromChannel(float* outBuffer, const float* inBuffer, unsigned int samplesCount, bool& outBufferIsSilent);
     void prepareAuxBuffers(size_t outBufferSize);
     void writeTrackToAuxBuffers(const float* trackBuffer, const AuxSendsParams& auxSends, samples_t samplesPerChannel);
@@ -96,6 +108,8 @@ private:
     std::vector<IFxProcessorPtr> m_masterFxProcessors = {};
 
     std::map<TrackId, MixerChannelPtr> m_trackChannels = {};
+    std::vector<TrackChannelData> m_trackChannelsData;
+    std::unique_ptr<ForkJoinPool> m_processingPool;
     std::unordered_set<TrackId> m_tracksToProcessWhenIdle;
 
     struct AuxChannelInfo {
@@ -115,6 +129,7 @@ private:
 
     bool m_isSilence = false;
     bool m_isIdle = false;
+    bool m_isOffline = false;
 };
 
 using MixerPtr = std::shared_ptr<Mixer>;
@@ -0,0 +1,102 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2023 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <gtest/gtest.h>
+
+#include <vector>
+
+#include "audio/internal/audiobuffer.h"
+#include "audio/internal/worker/sinesource.h"
+#include "audio/internal/audiosanitizer.h"
+
+using namespace mu;
+using namespace mu::audio;
+
+static constexpr audioch_t AUDIO_CHANNELS_COUNT = 2;
+static constexpr samples_t RENDER_STEP = 512;
+static constexpr samples_t DRIVER_SAMPLES = 512;
+
+namespace mu::audio {
+class Audio_AudioBufferTest : public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        AudioSanitizer::setupWorkerThread();
+
+        m_buffer.init(AUDIO_CHANNELS_COUNT, RENDER_STEP);
+        m_buffer.setMinSamplesToReserve(DRIVER_SAMPLES);
+        m_buffer.setSource(std::make_shared<SineSource>());
+
+        m_output.resize(DRIVER_SAMPLES * AUDIO_CHANNELS_COUNT);
+    }
+
+    void pop()
+    {
+        m_buffer.pop(m_output.data(), DRIVER_SAMPLES);
+    }
+
+    AudioBuffer m_buffer;
+    std::vector<float> m_output;
+};
+}
+
+TEST_F(Audio_AudioBufferTest, RenderAhead_GrowsOnUnderrun_ShrinksWhenStable)
+{
+    //! [GIVEN] Render-ahead starts at double buffering of the driver request
+    EXPECT_EQ(m_buffer.stats().renderAheadSamples, DRIVER_SAMPLES * 2);
+
+    //! [WHEN] The driver consumes more than was rendered
+    m_buffer.forward();
+    pop();
+    pop();
+    pop();
+
+    //! [THEN] An underrun is counted and the render-ahead grows by the request
+    EXPECT_EQ(m_buffer.stats().underruns, 1);
+    EXPECT_EQ(m_buffer.stats().renderAheadSamples, DRIVER_SAMPLES * 3);
+
+    //! [WHEN] Playback is stable for a while
+    for (int i = 0; i < 2100; ++i) {
+        m_buffer.forward();
+        pop();
+    }
+
+    //! [THEN] The render-ahead shrinks back, without new underruns
+    EXPECT_EQ(m_buffer.stats().underruns, 1);
+    EXPECT_EQ(m_buffer.stats().renderAheadSamples, DRIVER_SAMPLES * 2);
+}
+
+TEST_F(Audio_AudioBufferTest, Pop_RequestsData)
+{
+    //! [GIVEN] Nothing was consumed yet
+    EXPECT_FALSE(m_buffer.waitForDataRequest(std::chrono::microseconds(0)));
+
+    //! [WHEN] The driver consumes data
+    m_buffer.forward();
+    pop();
+
+    //! [THEN] The worker is woken up once
+    EXPECT_TRUE(m_buffer.waitForDataRequest(std::chrono::milliseconds(1)));
+    EXPECT_FALSE(m_buffer.waitForDataRequest(std::chrono::microseconds(0)));
+    EXPECT_EQ(m_buffer.stats().dataRequests, 1);
+}
@@ -0,0 +1,133 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2023 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <gtest/gtest.h>
+
+#include <variant>
+
+#include "audio/internal/abstracteventsequencer.h"
+#include "audio/internal/audiosanitizer.h"
+#include "midi/midievent.h"
+#include "midi/miditypes.h"
+
+using namespace mu;
+using namespace mu::audio;
+
+namespace mu::audio {
+class TestSequencer : public AbstractEventSequencer<midi::Event>
+{
+public:
+    void updateOffStreamEvents(const mpe::PlaybackEventsMap&) override {}
+    void updateMainStreamEvents(const mpe::PlaybackEventsMap&) override {}
+    void updateDynamicChanges(const mpe::DynamicLevelMap&) override {}
+
+    void addMainStreamEvent(const msecs_t timestamp, const midi::Event& event)
+    {
+        m_mainStreamEvents.add(timestamp, event);
+    }
+
+    void addDynamicEvent(const msecs_t timestamp, const midi::Event& event)
+    {
+        m_dynamicEvents.add(timestamp, event);
+    }
+};
+
+class Audio_EventSequencerTest : public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        AudioSanitizer::setupWorkerThread();
+    }
+
+    static midi::Event noteOn(int note)
+    {
+        midi::Event event(midi::Event::Opcode::NoteOn, midi::Event::MessageType::ChannelVoice20);
+        event.setNote(note);
+        event.setVelocity(100);
+        return event;
+    }
+
+    static midi::Event expression(int value)
+    {
+        midi::Event event(midi::Event::Opcode::ControlChange, midi::Event::MessageType::ChannelVoice20);
+        event.setIndex(midi::EXPRESSION_CONTROLLER);
+        event.setData(value);
+        return event;
+    }
+};
+}
+
+TEST_F(Audio_EventSequencerTest, EventOffsetsWithinBlock)
+{
+    // [GIVEN] Notes and a dynamic change inside the second block of 10000 us
+    TestSequencer sequencer;
+    sequencer.addMainStreamEvent(12500, noteOn(60));
+    sequencer.addMainStreamEvent(17000, noteOn(62));
+    sequencer.addMainStreamEvent(20000, noteOn(64));
+    sequencer.addDynamicEvent(12500, expression(90));
+    sequencer.addDynamicEvent(15000, expression(100));
+
+    sequencer.setActive(true);
+    sequencer.setPlaybackPosition(0);
+
+    // [WHEN] The first block is played
+    // [THEN] There is nothing to play
+    EXPECT_TRUE(sequencer.eventsToBePlayed(10000).empty());
+    EXPECT_TRUE(sequencer.eventOffsets().empty());
+
+    // [WHEN] The second block is played
+    const TestSequencer::EventSequence& events = sequencer.eventsToBePlayed(10000);
+    const std::vector<msecs_t>& offsets = sequencer.eventOffsets();
+
+    // [THEN] All the events are returned with their offsets from the block start, ascending
+    ASSERT_EQ(events.size(), 5u);
+    ASSERT_EQ(offsets.size(), 5u);
+
+    EXPECT_EQ(offsets.at(0), 2500);
+    EXPECT_EQ(std::get<midi::Event>(events.at(0)).opcode(), midi::Event::Opcode::ControlChange);
+    EXPECT_EQ(offsets.at(1), 2500);
+    EXPECT_EQ(std::get<midi::Event>(events.at(1)).note(), 60);
+    EXPECT_EQ(offsets.at(2), 5000);
+    EXPECT_EQ(std::get<midi::Event>(events.at(2)).opcode(), midi::Event::Opcode::ControlChange);
+    EXPECT_EQ(offsets.at(3), 7000);
+    EXPECT_EQ(std::get<midi::Event>(events.at(3)).note(), 62);
+    EXPECT_EQ(offsets.at(4), 10000);
+    EXPECT_EQ(std::get<midi::Event>(events.at(4)).note(), 64);
+}
+
+TEST_F(Audio_EventSequencerTest, EventOffsetsAfterSeek)
+{
+    // [GIVEN] A note in the middle of the score
+    TestSequencer sequencer;
+    sequencer.addMainStreamEvent(5000, noteOn(60));
+
+    sequencer.setActive(true);
+
+    // [WHEN] Seeking to the note and playing a block
+    sequencer.setPlaybackPosition(5000);
+    sequencer.eventsToBePlayed(1000);
+
+    // [THEN] The note is played at the start of the block
+    ASSERT_EQ(sequencer.eventOffsets().size(), 1u);
+    EXPECT_EQ(sequencer.eventOffsets().at(0), 0);
+}
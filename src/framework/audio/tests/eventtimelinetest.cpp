@@ -0,0 +1,217 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2023 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <iostream>
+#include <map>
+#include <set>
+#include <variant>
+
+#include "audio/internal/eventtimeline.h"
+#include "midi/midievent.h"
+
+using namespace mu;
+using namespace mu::audio;
+
+namespace mu::audio {
+class Audio_EventTimelineTest : public ::testing::Test
+{
+protected:
+    using EventType = std::variant<midi::Event>;
+    using Timeline = EventTimeline<EventType>;
+
+    static midi::Event noteOn(int note)
+    {
+        midi::Event event(midi::Event::Opcode::NoteOn, midi::Event::MessageType::ChannelVoice20);
+        event.setNote(note);
+        event.setVelocity(100);
+        return event;
+    }
+
+    static midi::Event noteOff(int note)
+    {
+        midi::Event event(midi::Event::Opcode::NoteOff, midi::Event::MessageType::ChannelVoice20);
+        event.setNote(note);
+        return event;
+    }
+};
+}
+
+TEST_F(Audio_EventTimelineTest, Finalize_SortsAndRemovesDuplicates)
+{
+    // [GIVEN] Events added in arbitrary order, one of them twice
+    Timeline timeline;
+    timeline.add(300, noteOff(60));
+    timeline.add(0, noteOn(60));
+    timeline.add(300, noteOn(62));
+    timeline.add(0, noteOn(60));
+
+    // [WHEN] The timeline is finalized
+    timeline.finalize();
+
+    // [THEN] The entries are sorted by timestamp and the duplicate is removed
+    ASSERT_EQ(timeline.size(), 3);
+    EXPECT_EQ(timeline.at(0).timestamp, 0);
+    EXPECT_EQ(timeline.at(1).timestamp, 300);
+    EXPECT_EQ(timeline.at(2).timestamp, 300);
+    EXPECT_TRUE(timeline.at(1).event < timeline.at(2).event);
+
+    // [THEN] Binary search finds the bounds of the timestamps
+    EXPECT_EQ(timeline.lowerBound(0), 0);
+    EXPECT_EQ(timeline.lowerBound(1), 1);
+    EXPECT_EQ(timeline.upperBound(300), 3);
+    EXPECT_EQ(timeline.lowerBound(301), 3);
+}
+
+TEST_F(Audio_EventTimelineTest, Replace_OnlyTheGivenRange)
+{
+    // [GIVEN] A timeline with events at 0, 100, 200, 300
+    Timeline timeline;
+    for (int i = 0; i < 4; ++i) {
+        timeline.add(i * 100, noteOn(60 + i));
+    }
+    timeline.finalize();
+
+    // [GIVEN] The newly rendered events, some of them are outside of the replaced range
+    Timeline rendered;
+    rendered.add(0, noteOn(70));
+    rendered.add(150, noteOn(71));
+    rendered.add(200, noteOn(72));
+    rendered.add(400, noteOn(73));
+    rendered.finalize();
+
+    // [WHEN] The range [100, 200] is replaced
+    timeline.replace(100, 200, rendered);
+
+    // [THEN] Only the events within the range are replaced
+    ASSERT_EQ(timeline.size(), 4);
+    EXPECT_EQ(timeline.at(0).timestamp, 0);
+    EXPECT_EQ(std::get<midi::Event>(timeline.at(0).event).note(), 60);
+    EXPECT_EQ(timeline.at(1).timestamp, 150);
+    EXPECT_EQ(std::get<midi::Event>(timeline.at(1).event).note(), 71);
+    EXPECT_EQ(timeline.at(2).timestamp, 200);
+    EXPECT_EQ(std::get<midi::Event>(timeline.at(2).event).note(), 72);
+    EXPECT_EQ(timeline.at(3).timestamp, 300);
+    EXPECT_EQ(std::get<midi::Event>(timeline.at(3).event).note(), 63);
+}
+
+//! NOTE Compares the timeline with the std::map<msecs_t, std::set<Event>> which was used by the sequencers before.
+//! Run it manually with --gtest_also_run_disabled_tests
+TEST_F(Audio_EventTimelineTest, DISABLED_SeekAndDispatchAgainstMap)
+{
+    using Clock = std::chrono::steady_clock;
+    using EventSequenceMap = std::map<msecs_t, std::set<EventType> >;
+
+    // [GIVEN] A large score: 30 minutes, 64 notes per second, note on/off for each of them
+    constexpr msecs_t DURATION = 30 * 60 * 1000000ll;
+    constexpr msecs_t NOTE_STEP = 1000000 / 64;
+    constexpr msecs_t BLOCK = 512 * 1000000ll / 48000;
+    constexpr int SEEK_COUNT = 100000;
+
+    EventSequenceMap map;
+    Timeline timeline;
+
+    int note = 0;
+    for (msecs_t timestamp = 0; timestamp < DURATION; timestamp += NOTE_STEP) {
+        int pitch = 36 + (note++ % 48);
+
+        map[timestamp].emplace(noteOn(pitch));
+        map[timestamp + NOTE_STEP * 3].emplace(noteOff(pitch));
+
+        timeline.add(timestamp, noteOn(pitch));
+        timeline.add(timestamp + NOTE_STEP * 3, noteOff(pitch));
+    }
+
+    timeline.finalize();
+
+    std::cout << "events: " << timeline.size() << std::endl;
+
+    // [WHEN] Seeking to random positions
+    std::vector<msecs_t> positions;
+    positions.reserve(SEEK_COUNT);
+    for (int i = 0; i < SEEK_COUNT; ++i) {
+        positions.push_back((static_cast<msecs_t>(i) * 7919 * BLOCK) % DURATION);
+    }
+
+    size_t checksum = 0;
+
+    auto start = Clock::now();
+    for (msecs_t position : positions) {
+        checksum += map.lower_bound(position) != map.cend();
+    }
+    auto mapSeekTime = Clock::now() - start;
+
+    start = Clock::now();
+    for (msecs_t position : positions) {
+        checksum += timeline.lowerBound(position);
+    }
+    auto timelineSeekTime = Clock::now() - start;
+
+    // [WHEN] Dispatching the whole score block by block
+    size_t mapEventsCount = 0;
+    start = Clock::now();
+    {
+        auto it = map.cbegin();
+        std::set<EventType> result;
+        for (msecs_t position = BLOCK; position <= DURATION + BLOCK * 4; position += BLOCK) {
+            result.clear();
+            for (; it != map.cend() && it->first <= position; ++it) {
+                result.insert(it->second.cbegin(), it->second.cend());
+            }
+            mapEventsCount += result.size();
+        }
+    }
+    auto mapDispatchTime = Clock::now() - start;
+
+    size_t timelineEventsCount = 0;
+    start = Clock::now();
+    {
+        size_t cursor = 0;
+        std::vector<EventType> result;
+        for (msecs_t position = BLOCK; position <= DURATION + BLOCK * 4; position += BLOCK) {
+            result.clear();
+            for (; cursor < timeline.size() && timeline.at(cursor).timestamp <= position; ++cursor) {
+                result.push_back(timeline.at(cursor).event);
+            }
+            timelineEventsCount += result.size();
+        }
+    }
+    auto timelineDispatchTime = Clock::now() - start;
+
+    // [THEN] Print the results
+    auto toMicros = [](Clock::duration duration) {
+        return std::chrono::duration_cast<std::chrono::microseconds>(duration).count();
+    };
+
+    size_t blocksCount = static_cast<size_t>((DURATION + BLOCK * 3) / BLOCK);
+
+    std::cout << "seek, " << SEEK_COUNT << " times: map " << toMicros(mapSeekTime) << " us, timeline "
+              << toMicros(timelineSeekTime) << " us" << std::endl;
+    std::cout << "dispatch, per block: map " << toMicros(mapDispatchTime) * 1000 / blocksCount << " ns, timeline "
+              << toMicros(timelineDispatchTime) * 1000 / blocksCount << " ns" << std::endl;
+    std::cout << "checksum: " << checksum << std::endl;
+
+    EXPECT_EQ(mapEventsCount, timeline.size());
+    EXPECT_EQ(timelineEventsCount, timeline.size());
+}
@@ -0,0 +1,176 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2023 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <iostream>
+
+#include "audio/internal/worker/mixer.h"
+#include "audio/internal/worker/sinesource.h"
+#include "audio/internal/worker/forkjoinpool.h"
+#include "audio/internal/audiosanitizer.h"
+
+#include "audio/tests/mocks/audioconfigurationmock.h"
+
+using ::testing::Return;
+
+using namespace mu;
+using namespace mu::audio;
+
+static constexpr unsigned int SAMPLE_RATE = 48000;
+static constexpr audioch_t AUDIO_CHANNELS_COUNT = 2;
+static constexpr samples_t SAMPLES_PER_CHANNEL = 512;
+
+namespace mu::audio {
+class Audio_MixerTest : public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        AudioSanitizer::setupWorkerThread();
+
+        m_configuration = std::make_shared<AudioConfigurationMock>();
+        modularity::ioc()->registerExport<IAudioConfiguration>("utests", m_configuration);
+    }
+
+    void TearDown() override
+    {
+        modularity::ioc()->unregister<IAudioConfiguration>("utests");
+    }
+
+    MixerPtr makeMixer(size_t trackCount, size_t minTrackCountForMultithreading)
+    {
+        ON_CALL(*m_configuration, minTrackCountForMultithreading())
+        .WillByDefault(Return(minTrackCountForMultithreading));
+
+        MixerPtr mixer = std::make_shared<Mixer>();
+        mixer->setAudioChannelsCount(AUDIO_CHANNELS_COUNT);
+        mixer->setSampleRate(SAMPLE_RATE);
+
+        for (size_t i = 0; i < trackCount; ++i) {
+            mixer->addChannel(static_cast<TrackId>(i), std::make_shared<SineSource>());
+        }
+
+        mixer->setIsActive(true);
+
+        return mixer;
+    }
+
+    std::shared_ptr<AudioConfigurationMock> m_configuration;
+};
+}
+
+TEST_F(Audio_MixerTest, ForkJoinPool_ProcessesEveryIndexOnce)
+{
+    ForkJoinPool pool(3);
+
+    std::vector<int> counters(100, 0);
+    auto func = [&counters](size_t index) {
+        counters[index]++;
+    };
+
+    for (size_t count = 1; count <= counters.size(); ++count) {
+        pool.run(count, func);
+    }
+
+    for (size_t i = 0; i < counters.size(); ++i) {
+        EXPECT_EQ(counters[i], static_cast<int>(counters.size() - i));
+    }
+}
+
+TEST_F(Audio_MixerTest, MultithreadedOutputIsEqualToSingleThreaded)
+{
+    //! [GIVEN] Two mixers with the same tracks, one processes them in parallel, another one sequentially
+    constexpr size_t TRACK_COUNT = 16;
+
+    MixerPtr parallelMixer = makeMixer(TRACK_COUNT, 1);
+    MixerPtr sequentialMixer = makeMixer(TRACK_COUNT, TRACK_COUNT + 1);
+
+    std::vector<float> parallelBuffer(SAMPLES_PER_CHANNEL * AUDIO_CHANNELS_COUNT);
+    std::vector<float> sequentialBuffer(SAMPLES_PER_CHANNEL * AUDIO_CHANNELS_COUNT);
+
+    for (int block = 0; block < 100; ++block) {
+        //! [WHEN] Process a block
+        samples_t parallelSamples = parallelMixer->process(parallelBuffer.data(), SAMPLES_PER_CHANNEL);
+        samples_t sequentialSamples = sequentialMixer->process(sequentialBuffer.data(), SAMPLES_PER_CHANNEL);
+
+        //! [THEN] The output is exactly the same
+        EXPECT_EQ(parallelSamples, sequentialSamples);
+        EXPECT_EQ(parallelBuffer, sequentialBuffer);
+    }
+}
+
+TEST_F(Audio_MixerTest, OfflineOutputIsEqualToRealtime)
+{
+    //! [GIVEN] Two mixers with fewer tracks than needed for multithreading, one of them is offline
+    constexpr size_t TRACK_COUNT = 2;
+
+    MixerPtr offlineMixer = makeMixer(TRACK_COUNT, TRACK_COUNT + 1);
+    offlineMixer->setIsOffline(true);
+
+    MixerPtr realtimeMixer = makeMixer(TRACK_COUNT, TRACK_COUNT + 1);
+
+    std::vector<float> offlineBuffer(SAMPLES_PER_CHANNEL * AUDIO_CHANNELS_COUNT);
+    std::vector<float> realtimeBuffer(SAMPLES_PER_CHANNEL * AUDIO_CHANNELS_COUNT);
+
+    for (int block = 0; block < 100; ++block) {
+        //! [WHEN] Process a block
+        samples_t offlineSamples = offlineMixer->process(offlineBuffer.data(), SAMPLES_PER_CHANNEL);
+        samples_t realtimeSamples = realtimeMixer->process(realtimeBuffer.data(), SAMPLES_PER_CHANNEL);
+
+        //! [THEN] The output is exactly the same, though the offline mixer processes the tracks in parallel
+        EXPECT_EQ(offlineSamples, realtimeSamples);
+        EXPECT_EQ(offlineBuffer, realtimeBuffer);
+    }
+}
+
+//! NOTE Benchmark, run it with --gtest_also_run_disabled_tests
+TEST_F(Audio_MixerTest, DISABLED_WorstCaseProcessTimeAgainstTrackCount)
+{
+    using clock = std::chrono::steady_clock;
+
+    constexpr int BLOCK_COUNT = 500;
+    std::vector<float> buffer(SAMPLES_PER_CHANNEL * AUDIO_CHANNELS_COUNT);
+
+    for (size_t trackCount : { 8, 16, 32, 64, 128 }) {
+        MixerPtr mixer = makeMixer(trackCount, 3);
+
+        clock::duration worst = clock::duration::zero();
+        clock::duration total = clock::duration::zero();
+
+        for (int block = 0; block < BLOCK_COUNT; ++block) {
+            clock::time_point start = clock::now();
+            mixer->process(buffer.data(), SAMPLES_PER_CHANNEL);
+            clock::duration elapsed = clock::now() - start;
+
+            worst = std::max(worst, elapsed);
+            total += elapsed;
+        }
+
+        std::cout << "tracks: " << trackCount
+                  << ", worst: " << std::chrono::duration_cast<std::chrono::microseconds>(worst).count() << " us"
+                  << ", average: " << std::chrono::duration_cast<std::chrono::microseconds>(total / BLOCK_COUNT).count() << " us"
+                  << ", block duration: " << (SAMPLES_PER_CHANNEL * 1000000 / SAMPLE_RATE) << " us"
+                  << std::endl;
+    }
+}
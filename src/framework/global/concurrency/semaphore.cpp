@@ -0,0 +1,131 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2023 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include "semaphore.h"
+
+#if defined(_WIN32)
+#include <windows.h>
+#elif !defined(__APPLE__)
+#include <cerrno>
+#include <ctime>
+#endif
+
+#include <climits>
+
+using namespace mu;
+
+#if defined(_WIN32)
+
+Semaphore::Semaphore(unsigned int initialCount)
+{
+    m_handle = CreateSemaphoreW(nullptr, static_cast<LONG>(initialCount), LONG_MAX, nullptr);
+}
+
+Semaphore::~Semaphore()
+{
+    CloseHandle(m_handle);
+}
+
+void Semaphore::release()
+{
+    ReleaseSemaphore(m_handle, 1, nullptr);
+}
+
+void Semaphore::acquire()
+{
+    WaitForSingleObject(m_handle, INFINITE);
+}
+
+bool Semaphore::tryAcquireFor(std::chrono::microseconds timeout)
+{
+    //! NOTE Rounded up, so a short timeout doesn't become a poll
+    DWORD ms = static_cast<DWORD>((timeout.count() + 999) / 1000);
+    return WaitForSingleObject(m_handle, ms) == WAIT_OBJECT_0;
+}
+
+#elif defined(__APPLE__)
+
+Semaphore::Semaphore(unsigned int initialCount)
+{
+    m_semaphore = dispatch_semaphore_create(static_cast<long>(initialCount));
+}
+
+Semaphore::~Semaphore()
+{
+    dispatch_release(m_semaphore);
+}
+
+void Semaphore::release()
+{
+    dispatch_semaphore_signal(m_semaphore);
+}
+
+void Semaphore::acquire()
+{
+    dispatch_semaphore_wait(m_semaphore, DISPATCH_TIME_FOREVER);
+}
+
+bool Semaphore::tryAcquireFor(std::chrono::microseconds timeout)
+{
+    dispatch_time_t deadline = dispatch_time(DISPATCH_TIME_NOW, std::chrono::nanoseconds(timeout).count());
+    return dispatch_semaphore_wait(m_semaphore, deadline) == 0;
+}
+
+#else
+
+Semaphore::Semaphore(unsigned int initialCount)
+{
+    sem_init(&m_semaphore, 0, initialCount);
+}
+
+Semaphore::~Semaphore()
+{
+    sem_destroy(&m_semaphore);
+}
+
+void Semaphore::release()
+{
+    sem_post(&m_semaphore);
+}
+
+void Semaphore::acquire()
+{
+    while (sem_wait(&m_semaphore) != 0 && errno == EINTR) {
+    }
+}
+
+bool Semaphore::tryAcquireFor(std::chrono::microseconds timeout)
+{
+    //! NOTE sem_timedwait takes an absolute time of CLOCK_REALTIME
+    timespec deadline;
+    clock_gettime(CLOCK_REALTIME, &deadline);
+
+    long long nsec = deadline.tv_nsec + std::chrono::nanoseconds(timeout).count();
+    deadline.tv_sec += static_cast<time_t>(nsec / 1000000000);
+    deadline.tv_nsec = static_cast<long>(nsec % 1000000000);
+
+    int ret = 0;
+    while ((ret = sem_timedwait(&m_semaphore, &deadline)) != 0 && errno == EINTR) {
+    }
+    return ret == 0;
+}
+
+#endif
@@ -0,0 +1,65 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2023 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#ifndef MU_GLOBAL_SEMAPHORE_H
+#define MU_GLOBAL_SEMAPHORE_H
+
+#include <chrono>
+
+#if defined(_WIN32)
+// HANDLE
+#elif defined(__APPLE__)
+#include <dispatch/dispatch.h>
+#else
+#include <semaphore.h>
+#endif
+
+namespace mu {
+//! NOTE Counting semaphore on top of the OS one, until we can use std::counting_semaphore (C++20).
+//! release() never blocks and never takes a lock, so it can be called from a real-time thread,
+//! for example the audio driver callback, to wake up a waiting thread
+class Semaphore
+{
+public:
+    explicit Semaphore(unsigned int initialCount = 0);
+    ~Semaphore();
+
+    Semaphore(const Semaphore&) = delete;
+    Semaphore& operator=(const Semaphore&) = delete;
+
+    void release();
+    void acquire();
+
+    //! NOTE Returns false on timeout
+    bool tryAcquireFor(std::chrono::microseconds timeout);
+
+private:
+#if defined(_WIN32)
+    void* m_handle = nullptr;
+#elif defined(__APPLE__)
+    dispatch_semaphore_t m_semaphore = nullptr;
+#else
+    sem_t m_semaphore;
+#endif
+};
+}
+
+#endif // MU_GLOBAL_SEMAPHORE_H
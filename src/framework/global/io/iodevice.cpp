@@ -49,6 +49,10 @@ bool IODevice::open(IODevice::OpenMode mode)
 
 void IODevice::close()
 {
+    if (isOpen()) {
+        doClose();
+    }
+
     m_mode = Unknown;
 }
 
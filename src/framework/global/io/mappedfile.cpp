@@ -0,0 +1,259 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2023 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include "mappedfile.h"
+
+#include <functional>
+#include <string>
+#include <thread>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <cstdio>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include "ioretcodes.h"
+
+#include "log.h"
+
+using namespace mu::io;
+
+MappedFile::MappedFile(const path_t& filePath)
+    : m_filePath(filePath)
+{
+}
+
+MappedFile::~MappedFile()
+{
+    close();
+    unmap();
+}
+
+path_t MappedFile::filePath() const
+{
+    return m_filePath;
+}
+
+bool MappedFile::isMapped() const
+{
+    return m_mapped != nullptr;
+}
+
+bool MappedFile::doOpen(OpenMode m)
+{
+    if (m != OpenMode::ReadOnly) {
+        NOT_SUPPORTED << "only read mode is supported";
+        return false;
+    }
+
+    unmap();
+    m_data = ByteArray();
+
+    if (map()) {
+        return true;
+    }
+
+    //! NOTE Empty files cannot be mapped, also mapping may be not available for some file systems
+    Ret ret = fileSystem()->readFile(m_filePath, m_data);
+    if (!ret) {
+        setError(ret.code(), ret.text());
+        return false;
+    }
+
+    return true;
+}
+
+void MappedFile::doClose()
+{
+    unmap();
+    m_data = ByteArray();
+}
+
+size_t MappedFile::dataSize() const
+{
+    return m_mapped ? m_mappedSize : m_data.size();
+}
+
+const uint8_t* MappedFile::rawData() const
+{
+    return m_mapped ? m_mapped : m_data.constData();
+}
+
+bool MappedFile::resizeData(size_t)
+{
+    NOT_SUPPORTED;
+    return false;
+}
+
+size_t MappedFile::writeData(const uint8_t*, size_t)
+{
+    NOT_SUPPORTED;
+    return 0;
+}
+
+mu::Ret MappedFile::writeFile(const path_t& filePath, const ByteArray& data)
+{
+    path_t tempPath = tempFilePath(filePath);
+
+    Ret ret = fileSystem()->writeFile(tempPath, data);
+    if (!ret) {
+        fileSystem()->remove(tempPath);
+        return ret;
+    }
+
+    if (!replaceFile(tempPath, filePath)) {
+        fileSystem()->remove(tempPath);
+        return make_ret(Err::FSMoveErrors);
+    }
+
+    return make_ret(Ret::Code::Ok);
+}
+
+#ifdef _WIN32
+
+bool MappedFile::map()
+{
+    std::wstring path = m_filePath.toStdWString();
+    HANDLE file = CreateFileW(path.c_str(), GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_DELETE, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+    if (file == INVALID_HANDLE_VALUE) {
+        return false;
+    }
+
+    LARGE_INTEGER size;
+    if (!GetFileSizeEx(file, &size) || size.QuadPart == 0) {
+        CloseHandle(file);
+        return false;
+    }
+
+    HANDLE mapping = CreateFileMappingW(file, NULL, PAGE_READONLY, 0, 0, NULL);
+    if (!mapping) {
+        CloseHandle(file);
+        return false;
+    }
+
+    const void* view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+    if (!view) {
+        CloseHandle(mapping);
+        CloseHandle(file);
+        return false;
+    }
+
+    m_fileHandle = file;
+    m_mappingHandle = mapping;
+    m_mapped = static_cast<const uint8_t*>(view);
+    m_mappedSize = static_cast<size_t>(size.QuadPart);
+
+    return true;
+}
+
+path_t MappedFile::tempFilePath(const path_t& filePath)
+{
+    //! NOTE Unique per process and thread, as several of them may write the same file
+    size_t threadId = std::hash<std::thread::id>()(std::this_thread::get_id());
+    return filePath + "." + std::to_string(GetCurrentProcessId()) + "-" + std::to_string(threadId) + ".tmp";
+}
+
+bool MappedFile::replaceFile(const path_t& srcPath, const path_t& dstPath)
+{
+    //! NOTE Fails while another process has the file open, then the old file is kept
+    std::wstring src = srcPath.toStdWString();
+    std::wstring dst = dstPath.toStdWString();
+    return MoveFileExW(src.c_str(), dst.c_str(), MOVEFILE_REPLACE_EXISTING | MOVEFILE_WRITE_THROUGH) != 0;
+}
+
+void MappedFile::unmap()
+{
+    if (m_mapped) {
+        UnmapViewOfFile(m_mapped);
+        m_mapped = nullptr;
+        m_mappedSize = 0;
+    }
+
+    if (m_mappingHandle) {
+        CloseHandle(m_mappingHandle);
+        m_mappingHandle = nullptr;
+    }
+
+    if (m_fileHandle) {
+        CloseHandle(m_fileHandle);
+        m_fileHandle = nullptr;
+    }
+}
+
+#else
+
+bool MappedFile::map()
+{
+    int fd = ::open(m_filePath.toStdString().c_str(), O_RDONLY);
+    if (fd < 0) {
+        return false;
+    }
+
+    struct stat st;
+    if (::fstat(fd, &st) != 0 || st.st_size <= 0) {
+        ::close(fd);
+        return false;
+    }
+
+    size_t size = static_cast<size_t>(st.st_size);
+    void* addr = ::mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+
+    //! NOTE The mapping stays valid after the descriptor is closed
+    ::close(fd);
+
+    if (addr == MAP_FAILED) {
+        return false;
+    }
+
+    m_mapped = static_cast<const uint8_t*>(addr);
+    m_mappedSize = size;
+
+    return true;
+}
+
+path_t MappedFile::tempFilePath(const path_t& filePath)
+{
+    //! NOTE Unique per process and thread, as several of them may write the same file
+    size_t threadId = std::hash<std::thread::id>()(std::this_thread::get_id());
+    return filePath + "." + std::to_string(::getpid()) + "-" + std::to_string(threadId) + ".tmp";
+}
+
+bool MappedFile::replaceFile(const path_t& srcPath, const path_t& dstPath)
+{
+    //! NOTE rename() replaces the file atomically, the mappings of the old file stay valid
+    return std::rename(srcPath.toStdString().c_str(), dstPath.toStdString().c_str()) == 0;
+}
+
+void MappedFile::unmap()
+{
+    if (m_mapped) {
+        ::munmap(const_cast<uint8_t*>(m_mapped), m_mappedSize);
+        m_mapped = nullptr;
+        m_mappedSize = 0;
+    }
+}
+
+#endif
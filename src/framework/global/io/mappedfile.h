@@ -0,0 +1,83 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2023 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#ifndef MU_IO_MAPPEDFILE_H
+#define MU_IO_MAPPEDFILE_H
+
+#include "iodevice.h"
+#include "path.h"
+
+#include "modularity/ioc.h"
+#include "ifilesystem.h"
+
+namespace mu::io {
+//! NOTE Read-only file device, the content of which is mapped into memory instead of being copied.
+//! Pages are loaded by the OS on first access, so reading a part of a big file (for example, one entry of a zip container)
+//! does not require reading the whole file.
+//! If the file cannot be mapped, falls back to reading it into memory.
+class MappedFile : public IODevice
+{
+    INJECT_STATIC(IFileSystem, fileSystem)
+public:
+
+    MappedFile() = default;
+    MappedFile(const path_t& filePath);
+    ~MappedFile();
+
+    path_t filePath() const;
+
+    bool isMapped() const;
+
+    //! NOTE Writes the data to a temporary file in the same directory and renames it over the file,
+    //! so readers, which have the file mapped or open, never see a truncated or partly written file
+    static Ret writeFile(const path_t& filePath, const ByteArray& data);
+
+protected:
+
+    bool doOpen(OpenMode m) override;
+    void doClose() override;
+    size_t dataSize() const override;
+    const uint8_t* rawData() const override;
+    bool resizeData(size_t size) override;
+    size_t writeData(const uint8_t* data, size_t len) override;
+
+private:
+
+    bool map();
+    void unmap();
+
+    static bool replaceFile(const path_t& srcPath, const path_t& dstPath);
+    static path_t tempFilePath(const path_t& filePath);
+
+    path_t m_filePath;
+
+    const uint8_t* m_mapped = nullptr;
+    size_t m_mappedSize = 0;
+#ifdef _WIN32
+    void* m_fileHandle = nullptr;
+    void* m_mappingHandle = nullptr;
+#endif
+
+    ByteArray m_data;
+};
+}
+
+#endif // MU_IO_MAPPEDFILE_H
@@ -23,6 +23,7 @@
 
 #include <ctime>
 #include <cstring>
+#include <unordered_map>
 #include <zlib.h>
 
 #include "io/dir.h"
@@ -374,6 +375,7 @@ struct ZipContainer::Impl {
 
     bool dirtyFileTree = true;
     std::vector<FileHeader> fileHeaders;
+    std::unordered_map<std::string, size_t> fileIndexes;
     ByteArray comment;
     uint start_of_directory = 0;
     ZipContainer::Status status = ZipContainer::NoError;
@@ -393,6 +395,7 @@ struct ZipContainer::Impl {
 
     void scanFiles();
     ZipContainer::FileInfo fillFileInfo(int index) const;
+    int indexOf(const std::string& fileName) const;
 };
 
 void ZipContainer::Impl::scanFiles()
@@ -482,10 +485,21 @@ void ZipContainer::Impl::scanFiles()
         }
 
         ZDEBUG("found file '%s'", header.file_name.data());
+        fileIndexes.emplace(std::string(reinterpret_cast<const char*>(header.file_name.constData()), header.file_name.size()),
+                            fileHeaders.size());
         fileHeaders.push_back(header);
     }
 }
 
+int ZipContainer::Impl::indexOf(const std::string& fileName) const
+{
+    auto it = fileIndexes.find(fileName);
+    if (it == fileIndexes.end()) {
+        return -1;
+    }
+    return static_cast<int>(it->second);
+}
+
 ZipContainer::FileInfo ZipContainer::Impl::fillFileInfo(int index) const
 {
     ZipContainer::FileInfo fileInfo;
@@ -649,6 +663,7 @@ void ZipContainer::Impl::addEntry(EntryType type, const std::string& fileName, c
     writeUInt(header.h.external_file_attributes, mode << 16);
     writeUInt(header.h.offset_local_header, start_of_directory);
 
+    fileIndexes.emplace(fileName, fileHeaders.size());
     fileHeaders.push_back(header);
 
     bool ok = true;
@@ -709,33 +724,19 @@ int ZipContainer::count() const
 bool ZipContainer::fileExists(const std::string& fileName) const
 {
     p->scanFiles();
-    ByteArray fileNameBa = ByteArray::fromRawData(fileName.c_str(), fileName.size());
-    for (size_t i = 0; i < p->fileHeaders.size(); ++i) {
-        if (p->fileHeaders.at(i).file_name == fileNameBa) {
-            return true;
-        }
-    }
-    return false;
+    return p->indexOf(fileName) != -1;
 }
 
 ByteArray ZipContainer::fileData(const std::string& fileName) const
 {
     p->scanFiles();
 
-    ByteArray fileNameBa = ByteArray::fromRawData(fileName.c_str(), fileName.size());
-
-    size_t i;
-    for (i = 0; i < p->fileHeaders.size(); ++i) {
-        if (p->fileHeaders.at(i).file_name == fileNameBa) {
-            break;
-        }
-    }
-
-    if (i == p->fileHeaders.size()) {
+    int i = p->indexOf(fileName);
+    if (i == -1) {
         return ByteArray();
     }
 
-    FileHeader header = p->fileHeaders.at(i);
+    const FileHeader& header = p->fileHeaders.at(i);
 
     ushort version_needed = readUShort(header.h.version_needed);
     if (version_needed > ZIP_VERSION) {
@@ -744,39 +745,49 @@ ByteArray ZipContainer::fileData(const std::string& fileName) const
     }
 
     ushort general_purpose_bits = readUShort(header.h.general_purpose_bits);
-    int compressed_size = readUInt(header.h.compressed_size);
-    int uncompressed_size = readUInt(header.h.uncompressed_size);
-    int start = readUInt(header.h.offset_local_header);
-
-    p->device->seek(start);
-    LocalFileHeader lh;
-    p->device->read((uint8_t*)&lh, sizeof(LocalFileHeader));
-    uint skip = readUShort(lh.file_name_length) + readUShort(lh.extra_field_length);
-    p->device->seek(p->device->pos() + skip);
-
-    int compression_method = readUShort(lh.compression_method);
+    size_t compressed_size = readUInt(header.h.compressed_size);
+    size_t uncompressed_size = readUInt(header.h.uncompressed_size);
+    size_t start = readUInt(header.h.offset_local_header);
 
     if ((general_purpose_bits & Encrypted) != 0) {
         LOGW("Zip: Unsupported encryption method is needed to extract the data.");
         return ByteArray();
     }
 
-    ByteArray compressed = p->device->read(compressed_size);
+    //! NOTE The entry is read straight from the device memory (mapped, for files),
+    //! without copying the compressed data into an intermediate buffer
+    const uint8_t* deviceData = p->device->readData();
+    const size_t deviceSize = p->device->size();
+    if (!deviceData || start + sizeof(LocalFileHeader) > deviceSize) {
+        LOGW("Zip: local header is out of range");
+        p->status = ZipContainer::FileReadError;
+        return ByteArray();
+    }
+
+    LocalFileHeader lh;
+    std::memcpy(&lh, deviceData + start, sizeof(LocalFileHeader));
+    size_t dataStart = start + sizeof(LocalFileHeader) + readUShort(lh.file_name_length) + readUShort(lh.extra_field_length);
+    if (dataStart > deviceSize) {
+        LOGW("Zip: entry data is out of range");
+        p->status = ZipContainer::FileReadError;
+        return ByteArray();
+    }
+
+    compressed_size = std::min(compressed_size, deviceSize - dataStart);
+    const uint8_t* compressed = deviceData + dataStart;
+
+    int compression_method = readUShort(lh.compression_method);
     if (compression_method == CompressionMethodStored) {
         // no compression
-        compressed.truncate(uncompressed_size);
-        return compressed;
+        return ByteArray(compressed, std::min(compressed_size, uncompressed_size));
     } else if (compression_method == CompressionMethodDeflated) {
         // Deflate
-        //qDebug("compressed=%d", compressed.size());
-        compressed.truncate(compressed_size);
         ByteArray baunzip;
-        ulong len = std::max(uncompressed_size,  1);
+        ulong len = std::max(uncompressed_size, size_t(1));
         int res;
         do {
             baunzip.resize(len);
-            res = inflate((uint8_t*)baunzip.data(), &len,
-                          (const uint8_t*)compressed.constData(), compressed_size);
+            res = inflate((uint8_t*)baunzip.data(), &len, compressed, (ulong)compressed_size);
 
             switch (res) {
             case Z_OK:
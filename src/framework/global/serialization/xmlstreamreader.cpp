@@ -248,53 +248,44 @@ AsciiStringView XmlStreamReader::name() const
     return (m_xml->node && m_xml->node->ToElement()) ? m_xml->node->Value() : AsciiStringView();
 }
 
-bool XmlStreamReader::hasAttribute(const char* name) const
+const char* XmlStreamReader::attributeValue(const char* name) const
 {
     if (m_token != TokenType::StartElement) {
-        return false;
+        return nullptr;
     }
 
     XMLElement* e = m_xml->node->ToElement();
     if (!e) {
-        return false;
+        return nullptr;
     }
-    return e->FindAttribute(name) != nullptr;
+    return e->Attribute(name);
 }
 
-String XmlStreamReader::attribute(const char* name) const
+bool XmlStreamReader::hasAttribute(const char* name) const
 {
-    if (m_token != TokenType::StartElement) {
-        return String();
-    }
+    return attributeValue(name) != nullptr;
+}
 
-    XMLElement* e = m_xml->node->ToElement();
-    if (!e) {
-        return String();
-    }
-    return String::fromUtf8(e->Attribute(name));
+String XmlStreamReader::attribute(const char* name) const
+{
+    return String::fromUtf8(attributeValue(name));
 }
 
 String XmlStreamReader::attribute(const char* name, const String& def) const
 {
-    return hasAttribute(name) ? attribute(name) : def;
+    const char* value = attributeValue(name);
+    return value ? String::fromUtf8(value) : def;
 }
 
 AsciiStringView XmlStreamReader::asciiAttribute(const char* name) const
 {
-    if (m_token != TokenType::StartElement) {
-        return AsciiStringView();
-    }
-
-    XMLElement* e = m_xml->node->ToElement();
-    if (!e) {
-        return AsciiStringView();
-    }
-    return e->Attribute(name);
+    return attributeValue(name);
 }
 
 AsciiStringView XmlStreamReader::asciiAttribute(const char* name, const AsciiStringView& def) const
 {
-    return hasAttribute(name) ? asciiAttribute(name) : def;
+    const char* value = attributeValue(name);
+    return value ? AsciiStringView(value) : def;
 }
 
 int XmlStreamReader::intAttribute(const char* name) const
@@ -304,7 +295,8 @@ int XmlStreamReader::intAttribute(const char* name) const
 
 int XmlStreamReader::intAttribute(const char* name, int def) const
 {
-    return hasAttribute(name) ? intAttribute(name) : def;
+    const char* value = attributeValue(name);
+    return value ? AsciiStringView(value).toInt() : def;
 }
 
 double XmlStreamReader::doubleAttribute(const char* name) const
@@ -314,7 +306,8 @@ double XmlStreamReader::doubleAttribute(const char* name) const
 
 double XmlStreamReader::doubleAttribute(const char* name, double def) const
 {
-    return hasAttribute(name) ? doubleAttribute(name) : def;
+    const char* value = attributeValue(name);
+    return value ? AsciiStringView(value).toDouble() : def;
 }
 
 std::vector<XmlStreamReader::Attribute> XmlStreamReader::attributes() const
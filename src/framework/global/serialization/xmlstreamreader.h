@@ -35,6 +35,8 @@
 #endif
 
 namespace mu {
+//! NOTE The `ascii*` methods (and `name`) return views into the parsed document (UTF-8 bytes) without copying,
+//! the views stay valid until the next `setData`; numbers are parsed directly from these bytes
 class XmlStreamReader
 {
 public:
@@ -125,6 +127,7 @@ private:
 
     void tryParseEntity(Xml* xml);
     String nodeValue(Xml* xml) const;
+    const char* attributeValue(const char* name) const;
 
     Xml* m_xml = nullptr;
     TokenType m_token = TokenType::NoToken;
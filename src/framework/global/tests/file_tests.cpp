@@ -24,6 +24,7 @@
 #include <cstring>
 
 #include "io/file.h"
+#include "io/mappedfile.h"
 
 using namespace mu;
 using namespace mu::io;
@@ -207,3 +208,46 @@ TEST_F(Global_IO_FileTests, FileTests_Exists_Append)
         EXPECT_EQ(refba, data);
     }
 }
+
+TEST_F(Global_IO_FileTests, FileTests_Mapped_Read)
+{
+    path_t filePath("FileTests_Mapped_Read.txt");
+    createFile(filePath, "Hello World!");
+
+    {
+        //! GIVEN Mapped file
+        MappedFile f(filePath);
+
+        //! DO Open file
+        EXPECT_TRUE(f.open(IODevice::ReadOnly));
+        EXPECT_TRUE(f.isMapped());
+
+        //! CHECK
+        EXPECT_EQ(f.size(), 12);
+
+        f.seek(6);
+        ByteArray data = f.read(5);
+
+        std::string ref = "World";
+        EXPECT_EQ(ByteArray(reinterpret_cast<const uint8_t*>(ref.c_str()), ref.size()), data);
+
+        //! DO Close file
+        f.close();
+
+        //! CHECK The mapping is released
+        EXPECT_FALSE(f.isMapped());
+    }
+
+    {
+        //! GIVEN Empty file, it cannot be mapped
+        path_t emptyFilePath("FileTests_Mapped_Empty.txt");
+        createFile(emptyFilePath, "");
+
+        MappedFile f(emptyFilePath);
+
+        //! CHECK Falls back to a regular read
+        EXPECT_TRUE(f.open(IODevice::ReadOnly));
+        EXPECT_FALSE(f.isMapped());
+        EXPECT_EQ(f.size(), 0);
+    }
+}
@@ -880,6 +880,44 @@ TEST_F(Global_Types_StringTests, AsciiString_ToDouble)
     }
 }
 
+TEST_F(Global_Types_StringTests, AsciiString_ToNumber_PlainNumbers)
+{
+    //! GIVEN Numbers the way they are written to files
+    const std::vector<std::string> doubles = {
+        "0", "-0", "1", "-1", "0.1", "-0.3", "1.5", "12.345", "0.000001", "123456.789012",
+        "3.14159265358979", "-2.718281828459045", "9007199254740992", "0.1234567890123456789012"
+    };
+
+    for (const std::string& str : doubles) {
+        //! DO
+        bool ok = false;
+        double v = AsciiStringView(str).toDouble(&ok);
+
+        //! CHECK Same result as strtod, bit-exact
+        EXPECT_TRUE(ok);
+        EXPECT_EQ(v, std::strtod(str.c_str(), nullptr)) << str;
+    }
+
+    {
+        //! GIVEN View that is not null-terminated
+        const char* str = "42,17";
+
+        //! DO
+        bool ok = false;
+        int v = AsciiStringView(str, 2).toInt(&ok);
+
+        //! CHECK Only the view is parsed
+        EXPECT_TRUE(ok);
+        EXPECT_EQ(v, 42);
+    }
+
+    {
+        //! GIVEN Negative and hex numbers
+        EXPECT_EQ(AsciiStringView("-17").toInt(), -17);
+        EXPECT_EQ(AsciiStringView("ff").toInt(nullptr, 16), 255);
+    }
+}
+
 TEST_F(Global_Types_StringTests, String_Remove)
 {
     //! GIVEN Some String
@@ -22,6 +22,7 @@
 #include "string.h"
 
 #include <algorithm>
+#include <charconv>
 #include <cstring>
 #include <cstdlib>
 #include <locale>
@@ -83,6 +84,74 @@ static double toDouble_helper(const char* str, bool* ok)
     return v;
 }
 
+//! NOTE Fast paths for plain numbers (the way they are written to files),
+//! parsed straight from the bytes, without switching the locale;
+//! anything else is left to the helpers above
+static bool fastToInt_helper(const char* str, size_t size, int base, int& out)
+{
+    if (!str || size == 0) {
+        return false;
+    }
+
+    std::from_chars_result res = std::from_chars(str, str + size, out, base);
+    return res.ec == std::errc() && res.ptr == str + size;
+}
+
+static bool fastToDouble_helper(const char* str, size_t size, double& out)
+{
+    //! NOTE Exactly representable powers of ten, see "Clinger's fast path"
+    static constexpr double POW10[] = {
+        1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+        1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+    };
+    static constexpr uint64_t MAX_EXACT_MANTISSA = uint64_t(1) << 53;
+    static constexpr int MAX_FRACTION_DIGITS = 22;
+
+    if (!str || size == 0) {
+        return false;
+    }
+
+    const char* p = str;
+    const char* end = str + size;
+
+    bool negative = false;
+    if (*p == '-') {
+        negative = true;
+        ++p;
+    }
+
+    uint64_t mantissa = 0;
+    int fractionDigits = 0;
+    bool hasDigits = false;
+    bool hasPoint = false;
+    for (; p != end; ++p) {
+        const char c = *p;
+        if (c >= '0' && c <= '9') {
+            mantissa = mantissa * 10 + uint64_t(c - '0');
+            if (mantissa > MAX_EXACT_MANTISSA) {
+                return false;
+            }
+            if (hasPoint) {
+                ++fractionDigits;
+            }
+            hasDigits = true;
+        } else if (c == '.' && !hasPoint) {
+            hasPoint = true;
+        } else {
+            return false;
+        }
+    }
+
+    if (!hasDigits || fractionDigits > MAX_FRACTION_DIGITS) {
+        return false;
+    }
+
+    // both operands are exact, so the division is correctly rounded, as strtod
+    double v = double(mantissa) / POW10[fractionDigits];
+    out = negative ? -v : v;
+    return true;
+}
+
 static void ltrim_helper(std::u16string& s)
 {
     s.erase(s.begin(), std::find_if(s.begin(), s.end(), [](char16_t ch) {
@@ -1274,10 +1343,24 @@ size_t AsciiStringView::indexOf(char ch) const
 
 int AsciiStringView::toInt(bool* ok, int base) const
 {
+    int v = 0;
+    if (fastToInt_helper(m_data, m_size, base, v)) {
+        if (ok) {
+            *ok = true;
+        }
+        return v;
+    }
     return toInt_helper(m_data, ok, base);
 }
 
 double AsciiStringView::toDouble(bool* ok) const
 {
+    double v = 0.0;
+    if (fastToDouble_helper(m_data, m_size, v)) {
+        if (ok) {
+            *ok = true;
+        }
+        return v;
+    }
     return toDouble_helper(m_data, ok);
 }
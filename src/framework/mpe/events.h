@@ -23,6 +23,7 @@
 #ifndef MU_MPE_EVENTS_H
 #define MU_MPE_EVENTS_H
 
+#include <algorithm>
 #include <variant>
 #include <vector>
 #include <optional>
@@ -42,6 +43,28 @@ using PlaybackEventsMap = std::map<msecs_t, PlaybackEventList>;
 using PlaybackEventsChanges = async::Channel<PlaybackEventsMap>;
 using DynamicLevelChanges = async::Channel<DynamicLevelMap>;
 
+struct TimestampRange {
+    timestamp_t from = 0;
+    timestamp_t to = 0;
+
+    bool operator==(const TimestampRange& other) const
+    {
+        return from == other.from && to == other.to;
+    }
+};
+
+using TimestampRangeList = std::vector<TimestampRange>;
+
+//! NOTE Partial update of a PlaybackEventsMap:
+//!      all events with timestamps within the ranges (inclusive) have to be replaced with the given events.
+//!      Insertion and removal are the cases when the old or the new events in a range are empty
+struct PlaybackEventsDelta {
+    TimestampRangeList ranges; // sorted and not overlapping
+    PlaybackEventsMap events;
+};
+
+using PlaybackEventsDeltaChanges = async::Channel<PlaybackEventsDelta>;
+
 struct ArrangementContext
 {
     timestamp_t nominalTimestamp = 0;
@@ -272,6 +295,89 @@ private:
     ArrangementContext m_arrangementCtx;
 };
 
+inline TimestampRangeList normalizedRanges(TimestampRangeList ranges)
+{
+    if (ranges.size() < 2) {
+        return ranges;
+    }
+
+    std::sort(ranges.begin(), ranges.end(), [](const TimestampRange& first, const TimestampRange& second) {
+        return first.from < second.from;
+    });
+
+    TimestampRangeList result;
+    result.reserve(ranges.size());
+    result.push_back(ranges.front());
+
+    for (size_t i = 1; i < ranges.size(); ++i) {
+        TimestampRange& last = result.back();
+
+        if (ranges[i].from <= last.to) {
+            last.to = std::max(last.to, ranges[i].to);
+        } else {
+            result.push_back(ranges[i]);
+        }
+    }
+
+    return result;
+}
+
+inline PlaybackEventsMap playbackEventsInRanges(const PlaybackEventsMap& events, const TimestampRangeList& ranges)
+{
+    PlaybackEventsMap result;
+
+    for (const TimestampRange& range : ranges) {
+        auto it = events.lower_bound(range.from);
+        auto last = events.upper_bound(range.to);
+
+        for (; it != last; ++it) {
+            result.insert(result.end(), *it);
+        }
+    }
+
+    return result;
+}
+
+inline void applyPlaybackEventsDelta(PlaybackEventsMap& events, const PlaybackEventsDelta& delta)
+{
+    for (const TimestampRange& range : delta.ranges) {
+        events.erase(events.lower_bound(range.from), events.upper_bound(range.to));
+    }
+
+    for (const auto& pair : delta.events) {
+        events.insert_or_assign(pair.first, pair.second);
+    }
+}
+
+//! NOTE The time range which may be affected by the event, placed at the given timestamp
+inline TimestampRange playbackEventTimeRange(const timestamp_t timestamp, const PlaybackEvent& event)
+{
+    TimestampRange result { timestamp, timestamp };
+
+    auto expand = [&result](const timestamp_t from, const timestamp_t to) {
+        result.from = std::min(result.from, from);
+        result.to = std::max(result.to, to);
+    };
+
+    if (std::holds_alternative<NoteEvent>(event)) {
+        const NoteEvent& noteEvent = std::get<NoteEvent>(event);
+        const ArrangementContext& arrangementCtx = noteEvent.arrangementCtx();
+
+        expand(arrangementCtx.actualTimestamp, arrangementCtx.actualTimestamp + arrangementCtx.actualDuration);
+        expand(arrangementCtx.nominalTimestamp, arrangementCtx.nominalTimestamp + arrangementCtx.nominalDuration);
+
+        for (const auto& pair : noteEvent.expressionCtx().articulations) {
+            const ArticulationMeta& meta = pair.second.meta;
+            expand(meta.timestamp, meta.timestamp + meta.overallDuration);
+        }
+    } else if (std::holds_alternative<RestEvent>(event)) {
+        const ArrangementContext& arrangementCtx = std::get<RestEvent>(event).arrangementCtx();
+        expand(arrangementCtx.actualTimestamp, arrangementCtx.actualTimestamp + arrangementCtx.actualDuration);
+    }
+
+    return result;
+}
+
 struct PlaybackSetupData
 {
     SoundId id = SoundId::Undefined;
@@ -372,6 +478,7 @@ struct PlaybackData {
     PlaybackEventsMap originEvents;
     PlaybackSetupData setupData;
     PlaybackEventsChanges mainStream;
+    PlaybackEventsDeltaChanges mainStreamDelta;
     PlaybackEventsChanges offStream;
     DynamicLevelMap dynamicLevelMap;
     DynamicLevelChanges dynamicLevelChanges;
@@ -65,12 +65,19 @@ void VstSequencer::updateMainStreamEvents(const mpe::PlaybackEventsMap& changes)
     updateMainSequenceIterator();
 }
 
+void VstSequencer::applyMainStreamDelta(const mpe::PlaybackEventsDelta& delta)
+{
+    applyMainStreamDeltaPartially(delta, [this](Timeline& destination, const mpe::PlaybackEventsMap& events) {
+        updatePlaybackEvents(destination, events);
+    });
+}
+
 void VstSequencer::updateDynamicChanges(const mpe::DynamicLevelMap& changes)
 {
     m_dynamicEvents.clear();
 
     for (const auto& pair : changes) {
-        m_dynamicEvents[pair.first].emplace(expressionLevel(pair.second));
+        m_dynamicEvents.add(pair.first, expressionLevel(pair.second));
     }
 
     updateDynamicChangesIterator();
@@ -82,7 +89,7 @@ audio::gain_t VstSequencer::currentGain() const
     return expressionLevel(currentDynamicLevel);
 }
 
-void VstSequencer::updatePlaybackEvents(EventSequenceMap& destination, const mpe::PlaybackEventsMap& changes)
+void VstSequencer::updatePlaybackEvents(Timeline& destination, const mpe::PlaybackEventsMap& changes)
 {
     for (const auto& pair : changes) {
         for (const mpe::PlaybackEvent& event : pair.second) {
@@ -99,15 +106,15 @@ void VstSequencer::updatePlaybackEvents(EventSequenceMap& destination, const mpe
             float velocityFraction = noteVelocityFraction(noteEvent);
             float tuning = noteTuning(noteEvent, noteId);
 
-            destination[timestampFrom].emplace(buildEvent(VstEvent::kNoteOnEvent, noteId, velocityFraction, tuning));
-            destination[timestampTo].emplace(buildEvent(VstEvent::kNoteOffEvent, noteId, velocityFraction, tuning));
+            destination.add(timestampFrom, buildEvent(VstEvent::kNoteOnEvent, noteId, velocityFraction, tuning));
+            destination.add(timestampTo, buildEvent(VstEvent::kNoteOffEvent, noteId, velocityFraction, tuning));
 
             appendControlSwitch(destination, noteEvent, PEDAL_CC_SUPPORTED_TYPES, SUSTAIN_IDX);
         }
     }
 }
 
-void VstSequencer::appendControlSwitch(EventSequenceMap& destination, const mpe::NoteEvent& noteEvent,
+void VstSequencer::appendControlSwitch(Timeline& destination, const mpe::NoteEvent& noteEvent,
                                        const mpe::ArticulationTypeSet& appliableTypes, const ControllIdx controlIdx)
 {
     auto controlIt = m_mapping.find(controlIdx);
@@ -128,10 +135,10 @@ void VstSequencer::appendControlSwitch(EventSequenceMap& destination, const mpe:
         const mpe::ArticulationAppliedData& articulationData = noteEvent.expressionCtx().articulations.at(currentType);
         const mpe::ArticulationMeta& articulationMeta = articulationData.meta;
 
-        destination[noteEvent.arrangementCtx().actualTimestamp].emplace(buildParamInfo(controlIt->second, 1 /*on*/));
-        destination[articulationMeta.timestamp + articulationMeta.overallDuration].emplace(buildParamInfo(controlIt->second, 0 /*off*/));
+        destination.add(noteEvent.arrangementCtx().actualTimestamp, buildParamInfo(controlIt->second, 1 /*on*/));
+        destination.add(articulationMeta.timestamp + articulationMeta.overallDuration, buildParamInfo(controlIt->second, 0 /*off*/));
     } else {
-        destination[noteEvent.arrangementCtx().actualTimestamp].emplace(buildParamInfo(controlIt->second, 0 /*off*/));
+        destination.add(noteEvent.arrangementCtx().actualTimestamp, buildParamInfo(controlIt->second, 0 /*off*/));
     }
 }
 
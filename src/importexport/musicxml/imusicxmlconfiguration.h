@@ -39,6 +39,11 @@ public:
     virtual bool musicxmlImportLayout() const = 0;
     virtual void setMusicxmlImportLayout(bool value) = 0;
 
+    //! NOTE If enabled, the file is validated against the MusicXML schema
+    //!      only if the import itself fails, to report why
+    virtual bool musicxmlImportLazyValidation() const = 0;
+    virtual void setMusicxmlImportLazyValidation(bool value) = 0;
+
     virtual bool musicxmlExportLayout() const = 0;
     virtual void setMusicxmlExportLayout(bool value) = 0;
 
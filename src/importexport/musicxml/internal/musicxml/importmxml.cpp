@@ -20,6 +20,7 @@
  * along with this program.  If not, see <https://www.gnu.org/licenses/>.
  */
 
+#include <QElapsedTimer>
 #include <QMessageBox>
 
 #include "translation.h"
@@ -32,6 +33,8 @@
 #include "engraving/dom/part.h"
 #include "engraving/dom/score.h"
 
+#include "log.h"
+
 namespace mu::engraving {
 //---------------------------------------------------------
 //   musicXMLImportErrorDialog
@@ -95,17 +98,23 @@ Err importMusicXMLfromBuffer(Score* score, const QString& /*name*/, QIODevice* d
     //logger.setLoggingLevel(MxmlLogger::Level::MXML_INFO);
     //logger.setLoggingLevel(MxmlLogger::Level::MXML_TRACE); // also include tracing
 
+    QElapsedTimer t;
+
     // pass 1
+    t.start();
     dev->seek(0);
     MusicXMLParserPass1 pass1(score, &logger);
     Err res = pass1.parse(dev);
     const auto pass1_errors = pass1.errors();
+    LOGD("Pass 1 time elapsed: %lld ms", t.elapsed());
 
     // pass 2
     MusicXMLParserPass2 pass2(score, pass1, &logger);
     if (res == Err::NoError) {
+        t.restart();
         dev->seek(0);
         res = pass2.parse(dev);
+        LOGD("Pass 2 time elapsed: %lld ms", t.elapsed());
     }
 
     for (const Part* part : score->parts()) {
@@ -26,6 +26,7 @@
 
 #include <QBuffer>
 #include <QDomDocument>
+#include <QElapsedTimer>
 #include <QMessageBox>
 #include <QXmlSchema>
 #include <QXmlSchemaValidator>
@@ -41,8 +42,22 @@
 
 #include "engraving/dom/masterscore.h"
 
+#include "modularity/ioc.h"
+#include "importexport/musicxml/imusicxmlconfiguration.h"
+
 #include "log.h"
 
+static std::shared_ptr<mu::iex::musicxml::IMusicXmlConfiguration> configuration()
+{
+    return mu::modularity::ioc()->resolve<mu::iex::musicxml::IMusicXmlConfiguration>("iex_musicxml");
+}
+
+static bool musicxmlImportLazyValidation()
+{
+    auto conf = configuration();
+    return conf ? conf->musicxmlImportLazyValidation() : false;
+}
+
 namespace mu::engraving {
 //---------------------------------------------------------
 //   check assertions for tuplet handling
@@ -104,6 +119,26 @@ static bool initMusicXmlSchema(QXmlSchema& schema)
     return true;
 }
 
+//---------------------------------------------------------
+//   musicXmlSchema
+//    return nullptr on error
+//---------------------------------------------------------
+
+/**
+ Return the MusicXML schema, compiled on first use and shared by all imports.
+ */
+
+static const QXmlSchema* musicXmlSchema()
+{
+    //! NOTE Compiling the schema takes much longer than validating a typical file,
+    //!      so it's done only once per process. Imports run on the main thread,
+    //!      the schema is not meant to be used by concurrent validators
+    static QXmlSchema schema;
+    static const bool isValid = initMusicXmlSchema(schema);
+
+    return isValid ? &schema : nullptr;
+}
+
 //---------------------------------------------------------
 //   musicXMLValidationErrorDialog
 //---------------------------------------------------------
@@ -182,29 +217,53 @@ static bool extractRootfile(QFile* qf, QByteArray& data)
 }
 
 //---------------------------------------------------------
-//   doValidate
+//   validate
 //---------------------------------------------------------
 
 /**
  Validate MusicXML data from file \a name contained in QIODevice \a dev.
+ Set \a valid and return the validation errors in \a errors.
  */
 
-static Err doValidate(const QString& name, QIODevice* dev)
+static Err validate(const QString& name, QIODevice* dev, bool& valid, QString& errors)
 {
-    //QElapsedTimer t;
-    //t.start();
+    QElapsedTimer t;
+    t.start();
 
-    // initialize the schema
-    ValidatorMessageHandler messageHandler;
-    QXmlSchema schema;
-    schema.setMessageHandler(&messageHandler);
-    if (!initMusicXmlSchema(schema)) {
+    // get the schema
+    const QXmlSchema* schema = musicXmlSchema();
+    if (!schema) {
         return Err::FileBadFormat;      // appropriate error message has been printed by initMusicXmlSchema
     }
     // validate the data
-    QXmlSchemaValidator validator(schema);
-    bool valid = validator.validate(dev, QUrl::fromLocalFile(name));
-    //LOGD("Validation time elapsed: %d ms", t.elapsed());
+    ValidatorMessageHandler messageHandler;
+    QXmlSchemaValidator validator(*schema);
+    validator.setMessageHandler(&messageHandler);
+    dev->seek(0);
+    valid = validator.validate(dev, QUrl::fromLocalFile(name));
+    errors = messageHandler.getErrors();
+    LOGD("Validation time elapsed: %lld ms", t.elapsed());
+
+    return Err::NoError;
+}
+
+//---------------------------------------------------------
+//   doValidate
+//---------------------------------------------------------
+
+/**
+ Validate MusicXML data from file \a name contained in QIODevice \a dev,
+ ask the user whether to load an invalid file anyway.
+ */
+
+static Err doValidate(const QString& name, QIODevice* dev)
+{
+    bool valid = false;
+    QString errors;
+    Err res = validate(name, dev, valid, errors);
+    if (res != Err::NoError) {
+        return res;
+    }
 
     if (!valid) {
         LOGD("importMusicXml() file '%s' is not a valid MusicXML file", qPrintable(name));
@@ -212,7 +271,7 @@ static Err doValidate(const QString& name, QIODevice* dev)
         if (MScore::noGui) {
             return Err::NoError;         // might as well try anyhow in converter mode
         }
-        if (musicXMLValidationErrorDialog(strErr, messageHandler.getErrors()) != QMessageBox::Yes) {
+        if (musicXMLValidationErrorDialog(strErr, errors) != QMessageBox::Yes) {
             return Err::UserAbort;
         }
     }
@@ -220,6 +279,26 @@ static Err doValidate(const QString& name, QIODevice* dev)
     return Err::NoError;
 }
 
+//---------------------------------------------------------
+//   logValidation
+//---------------------------------------------------------
+
+/**
+ Validate MusicXML data from file \a name contained in QIODevice \a dev
+ and only log the errors, the import has already failed at this point.
+ */
+
+static void logValidation(const QString& name, QIODevice* dev)
+{
+    bool valid = false;
+    QString errors;
+    if (validate(name, dev, valid, errors) != Err::NoError || valid) {
+        return;
+    }
+
+    LOGW("importMusicXml() file '%s' is not a valid MusicXML file:\n%s", qPrintable(name), qPrintable(errors));
+}
+
 //---------------------------------------------------------
 //   doValidateAndImport
 //---------------------------------------------------------
@@ -230,6 +309,16 @@ static Err doValidate(const QString& name, QIODevice* dev)
 
 static Err doValidateAndImport(Score* score, const QString& name, QIODevice* dev)
 {
+    if (musicxmlImportLazyValidation()) {
+        // import first, validate only to explain a failure
+        Err res = importMusicXMLfromBuffer(score, name, dev);
+        if (res != Err::NoError && res != Err::UserAbort) {
+            LOGD("importMusicXml() import of '%s' failed, validating", qPrintable(name));
+            logValidation(name, dev);
+        }
+        return res;
+    }
+
     // validate the file
     Err res = doValidate(name, dev);
     if (res != Err::NoError) {
@@ -23,6 +23,7 @@
 #include <gtest/gtest.h>
 
 #include "engraving/engravingerrors.h"
+#include "engraving/compat/scoreaccess.h"
 #include "engraving/dom/masterscore.h"
 
 #include "settings.h"
@@ -51,6 +52,7 @@ static const std::string MODULE_NAME("importexport");
 
 static const std::string PREF_EXPORT_MUSICXML_EXPORTBREAKS("export/musicXML/exportBreaks");
 static const std::string PREF_IMPORT_MUSICXML_IMPORTBREAKS("import/musicXML/importBreaks");
+static const std::string PREF_IMPORT_MUSICXML_LAZYVALIDATION("import/musicXML/lazyValidation");
 static const std::string PREF_EXPORT_MUSICXML_EXPORTLAYOUT("export/musicXML/exportLayout");
 static const std::string PREF_EXPORT_MUSICXML_EXPORTINVISIBLE("export/musicXML/exportInvisibleElements");
 
@@ -587,6 +589,11 @@ TEST_F(Musicxml_Tests, harmony6) {
 TEST_F(Musicxml_Tests, hello) {
     mxmlIoTest("testHello");
 }
+TEST_F(Musicxml_Tests, helloLazyValidation) {
+    setValue(PREF_IMPORT_MUSICXML_LAZYVALIDATION, Val(true));
+    mxmlIoTest("testHello");
+    setValue(PREF_IMPORT_MUSICXML_LAZYVALIDATION, Val(false));
+}
 TEST_F(Musicxml_Tests, helloReadCompr) {
     mxmlReadTestCompr("testHello");
 }
@@ -614,6 +621,15 @@ TEST_F(Musicxml_Tests, instrumentChangeMIDIportExport) {
 TEST_F(Musicxml_Tests, instrumentSound) {
     mxmlIoTestRef("testInstrumentSound");
 }
+TEST_F(Musicxml_Tests, invalidLazyValidation) {
+    setValue(PREF_IMPORT_MUSICXML_LAZYVALIDATION, Val(true));
+    MasterScore* score = compat::ScoreAccess::createMasterScoreWithBaseStyle();
+    String path = ScoreRW::rootPath() + u"/" + XML_IO_DATA_DIR + u"testInvalidLazyValidation.xml";
+    // the import fails, validation is then done only to log the errors, without asking the user
+    EXPECT_EQ(mu::engraving::importMusicXml(score, path.toQString()), engraving::Err::FileBadFormat);
+    delete score;
+    setValue(PREF_IMPORT_MUSICXML_LAZYVALIDATION, Val(false));
+}
 TEST_F(Musicxml_Tests, invalidLayout) {
     mxmlMscxExportTestRef("testInvalidLayout");
 }
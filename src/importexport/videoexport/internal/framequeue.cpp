@@ -0,0 +1,73 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2023 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include "framequeue.h"
+
+using namespace mu::iex::videoexport;
+
+FrameQueue::FrameQueue(size_t capacity)
+    : m_capacity(capacity > 0 ? capacity : 1)
+{
+}
+
+bool FrameQueue::push(QImage frame)
+{
+    std::unique_lock<std::mutex> lock(m_mutex);
+    m_notFull.wait(lock, [this]() { return m_closed || m_frames.size() < m_capacity; });
+
+    if (m_closed) {
+        return false;
+    }
+
+    m_frames.push_back(std::move(frame));
+    lock.unlock();
+
+    m_notEmpty.notify_one();
+    return true;
+}
+
+bool FrameQueue::pop(QImage& frame)
+{
+    std::unique_lock<std::mutex> lock(m_mutex);
+    m_notEmpty.wait(lock, [this]() { return m_closed || !m_frames.empty(); });
+
+    if (m_frames.empty()) {
+        return false;
+    }
+
+    frame = std::move(m_frames.front());
+    m_frames.pop_front();
+    lock.unlock();
+
+    m_notFull.notify_one();
+    return true;
+}
+
+void FrameQueue::close()
+{
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_closed = true;
+    }
+
+    m_notFull.notify_all();
+    m_notEmpty.notify_all();
+}
@@ -0,0 +1,58 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2023 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#ifndef MU_IMPORTEXPORT_FRAMEQUEUE_H
+#define MU_IMPORTEXPORT_FRAMEQUEUE_H
+
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+
+#include <QImage>
+
+namespace mu::iex::videoexport {
+//! NOTE Bounded queue of video frames between the painting and the encoding thread.
+//! push() blocks while the queue is full, pop() blocks while it is empty
+class FrameQueue
+{
+public:
+    explicit FrameQueue(size_t capacity);
+
+    //! NOTE Returns false if the queue has been closed
+    bool push(QImage frame);
+
+    //! NOTE Returns false if the queue has been closed and all frames have been taken
+    bool pop(QImage& frame);
+
+    void close();
+
+private:
+    const size_t m_capacity = 0;
+    std::deque<QImage> m_frames;
+    bool m_closed = false;
+
+    std::mutex m_mutex;
+    std::condition_variable m_notFull;
+    std::condition_variable m_notEmpty;
+};
+}
+
+#endif // MU_IMPORTEXPORT_FRAMEQUEUE_H
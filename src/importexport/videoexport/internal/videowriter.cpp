@@ -21,7 +21,12 @@
  */
 #include "videowriter.h"
 
+#include <thread>
+
+#include <QElapsedTimer>
+
 #include "videoencoder.h"
+#include "framequeue.h"
 
 #include "engraving/dom/page.h"
 #include "engraving/dom/system.h"
@@ -36,6 +41,9 @@ using namespace mu::iex::videoexport;
 using namespace mu::project;
 using namespace mu::notation;
 
+//! NOTE Enough to keep the encoder busy while the next page is being painted
+static constexpr size_t FRAME_QUEUE_CAPACITY = 8;
+
 std::vector<IProjectWriter::UnitType> VideoWriter::supportedUnitTypes() const
 {
     return { UnitType::PER_PART };
@@ -172,19 +180,40 @@ mu::Ret VideoWriter::generatePagedOriginalVideo(INotationProjectPtr project, con
     score->update();
 
     // Setup painting
-    QImage frame(config.width, config.height, QImage::Format_RGB32);
-    frame.setDotsPerMeterX(std::lrint((CANVAS_DPI * 1000) / engraving::INCH));
-    frame.setDotsPerMeterY(std::lrint((CANVAS_DPI * 1000) / engraving::INCH));
-
-    QPainter qp(&frame);
-    qp.setRenderHint(QPainter::Antialiasing, true);
-    qp.setRenderHint(QPainter::TextAntialiasing, true);
-    RectF frameRect = RectF::fromQRectF(QRectF(frame.rect()));
+    //! NOTE The page is painted only when it changes, every frame is a copy of it with the cursor on top
+    QImage pageImage(config.width, config.height, QImage::Format_RGB32);
+    pageImage.setDotsPerMeterX(std::lrint((CANVAS_DPI * 1000) / engraving::INCH));
+    pageImage.setDotsPerMeterY(std::lrint((CANVAS_DPI * 1000) / engraving::INCH));
 
-    draw::Painter painter(&qp, "video_writer");
+    const Page* paintedPage = nullptr;
+    QTransform pageTransform;
+    int paintedPageCount = 0;
 
     auto painting = masterNotation->notation()->painting();
 
+    auto paintPage = [&](const Page* page) {
+        pageImage.fill(Qt::white);
+
+        QPainter qp(&pageImage);
+        qp.setRenderHint(QPainter::Antialiasing, true);
+        qp.setRenderHint(QPainter::TextAntialiasing, true);
+
+        draw::Painter painter(&qp, "video_writer");
+
+        INotationPainting::Options opt;
+        opt.fromPage = page->no();
+        opt.toPage = opt.fromPage;
+        opt.deviceDpi = CANVAS_DPI;
+
+        painting->paintPrint(&painter, opt);
+
+        //! NOTE The painting sets up the viewport, keep it to map the cursor to the frame
+        pageTransform = qp.combinedTransform();
+
+        paintedPage = page;
+        ++paintedPageCount;
+    };
+
     // Setup duration
     INotationPlaybackPtr playback = masterNotation->playback();
     float totalPlayTimeSec = playback->totalPlayTime() / 1000.0;
@@ -210,6 +239,19 @@ mu::Ret VideoWriter::generatePagedOriginalVideo(INotationProjectPtr project, con
     PlaybackCursor cursor;
     cursor.setNotation(masterNotation->notation());
 
+    // Setup encoding
+    //! NOTE Frames are encoded on a separate thread, so painting and encoding overlap
+    FrameQueue frameQueue(FRAME_QUEUE_CAPACITY);
+    std::thread encodingThread([&encoder, &frameQueue]() {
+        QImage frame;
+        while (frameQueue.pop(frame)) {
+            encoder.encodeImage(frame);
+        }
+    });
+
+    QElapsedTimer timer;
+    timer.start();
+
     for (int f = 0; f < frameCount; f++) {
         float currentTimeSec = (qreal)f / config.fps;
         currentTimeSec -= config.leadingSec;
@@ -227,14 +269,9 @@ mu::Ret VideoWriter::generatePagedOriginalVideo(INotationProjectPtr project, con
             break;
         }
 
-        INotationPainting::Options opt;
-        opt.fromPage = page->no();
-        opt.toPage = opt.fromPage;
-        opt.deviceDpi = CANVAS_DPI;
-
-        painter.fillRect(frameRect, draw::Color::WHITE);
-
-        painting->paintPrint(&painter, opt);
+        if (page != paintedPage) {
+            paintPage(page);
+        }
 
         cursor.move(tick);
 
@@ -242,12 +279,21 @@ mu::Ret VideoWriter::generatePagedOriginalVideo(INotationProjectPtr project, con
         PointF pagePos = page->pos();
         RectF cursorAbsRect = cursorRect.translated(-pagePos);
 
-        painter.fillRect(cursorAbsRect, CURSOR_COLOR);
+        QImage frame = pageImage.copy();
+        {
+            QPainter qp(&frame);
+            qp.fillRect(pageTransform.mapRect(cursorAbsRect.toQRectF()), CURSOR_COLOR.toQColor());
+        }
 
-        encoder.encodeImage(frame);
+        frameQueue.push(std::move(frame));
     }
 
+    frameQueue.close();
+    encodingThread.join();
+
     encoder.close();
 
+    LOGI() << "video exported in " << timer.elapsed() << " ms, frames: " << frameCount << ", painted pages: " << paintedPageCount;
+
     return make_ok();
 }
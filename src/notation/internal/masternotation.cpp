@@ -87,6 +87,15 @@ MasterNotation::MasterNotation()
     partList.onItemRemoved(this, [this](const Part*) {
         onPartsChanged();
     });
+
+    engravingConfiguration()->undoHistoryLimitsChanged().onNotify(this, [this]() {
+        if (!masterScore()) {
+            return;
+        }
+
+        masterScore()->undoStack()->setLimits(engravingConfiguration()->undoHistoryMaxSteps(),
+                                              engravingConfiguration()->undoHistoryMaxMemory());
+    });
 }
 
 MasterNotation::~MasterNotation()
@@ -532,7 +532,6 @@ std::vector<mu::engraving::EngravingItem*> NotationInteraction::hitElements(cons
     }
 
     for (mu::engraving::EngravingItem* element : elements) {
-        element->itemDiscovered = 0;
         if (!element->selectable() || element->isPage()) {
             continue;
         }
@@ -266,9 +266,9 @@ int NotationSelectionRange::sectionElementsMaxY(const NotationSelectionRange::Ra
 
     mu::engraving::SysStaff* segmentFirstStaff = segmentSystem->staff(score()->selection().staffStart());
 
-    mu::engraving::SkylineLine north = segmentFirstStaff->skyline().north();
+    const mu::engraving::SkylineLine& north = segmentFirstStaff->skyline().north();
     int maxY = INT_MAX;
-    for (mu::engraving::SkylineSegment segment: north) {
+    for (const mu::engraving::SkylineSegment& segment: north) {
         bool ok = segment.x >= startSegment->pagePos().x() && segment.x <= endSegment->pagePos().x();
         if (!ok) {
             continue;
@@ -295,9 +295,9 @@ int NotationSelectionRange::sectionElementsMinY(const NotationSelectionRange::Ra
     int lastStaff = selectionLastVisibleStaff();
     mu::engraving::SysStaff* segmentLastStaff = segmentSystem->staff(lastStaff);
 
-    mu::engraving::SkylineLine south = segmentLastStaff->skyline().south();
+    const mu::engraving::SkylineLine& south = segmentLastStaff->skyline().south();
     int minY = INT_MIN;
-    for (mu::engraving::SkylineSegment segment: south) {
+    for (const mu::engraving::SkylineSegment& segment: south) {
         bool ok = segment.x >= startSegment->pagePos().x() && segment.x <= endSegment->pagePos().x();
         if (!ok) {
             continue;
@@ -22,6 +22,7 @@
 #include "notationmodule.h"
 
 #include <QQmlEngine>
+#include <sstream>
 
 #include "modularity/ioc.h"
 #include "ui/iuiengine.h"
@@ -83,7 +84,10 @@
 #include "view/styledialog/bendstyleselector.h"
 #include "view/styledialog/tieplacementselector.h"
 
+#include "engraving/dom/undo.h"
+
 #include "diagnostics/idiagnosticspathsregister.h"
+#include "diagnostics/idiagnosticscountersregister.h"
 
 using namespace mu::notation;
 using namespace mu::modularity;
@@ -261,4 +265,19 @@ void NotationModule::onInit(const framework::IApplication::RunMode& mode)
             pr->reg("user scoreOrder", p);
         }
     }
+
+    auto cr = modularity::ioc()->resolve<diagnostics::IDiagnosticsCountersRegister>(moduleName());
+    if (cr) {
+        cr->reg("Undo history", []() {
+            const engraving::UndoStack::Statistic& st = engraving::UndoStack::statistic();
+
+            std::stringstream ss;
+            ss << "steps: " << st.steps
+               << ", memory: " << st.memoryUsage / 1024 << " KB"
+               << ", discarded steps: " << st.discardedSteps << " (" << st.discardedMemoryUsage / 1024 << " KB)"
+               << ", merged property changes: " << st.mergedCommands;
+
+            return ss.str();
+        });
+    }
 }
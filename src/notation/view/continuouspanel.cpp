@@ -127,7 +127,6 @@ void ContinuousPanel::paint(mu::draw::Painter& painter, const NotationViewContex
     const mu::engraving::Measure* currentMeasure = nullptr;
     bool showInvisible = score->isShowInvisible();
     for (const mu::engraving::EngravingItem* e : el) {
-        e->itemDiscovered = false;
         if (!e->visible() && !showInvisible) {
             continue;
         }
@@ -171,7 +170,6 @@ void ContinuousPanel::paint(mu::draw::Painter& painter, const NotationViewContex
     qreal xPosTimeSig  = 0;
 
     for (const mu::engraving::EngravingItem* e : qAsConst(el)) {
-        e->itemDiscovered = false;
         if (!e->visible() && !showInvisible) {
             continue;
         }
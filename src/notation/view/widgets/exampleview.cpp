@@ -153,7 +153,6 @@ void ExampleView::drawBackground(mu::draw::Painter* p, const RectF& r) const
 void ExampleView::drawElements(mu::draw::Painter& painter, const std::vector<EngravingItem*>& el)
 {
     for (EngravingItem* e : el) {
-        e->itemDiscovered = 0;
         PointF pos(e->pagePos());
         painter.translate(pos);
         EngravingItem::renderer()->drawItem(e, &painter);
@@ -0,0 +1,102 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2023 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include "palettecelliconcache.h"
+
+#include <sstream>
+#include <tuple>
+
+using namespace mu::palette;
+
+//! NOTE All the cells of all the palettes fit in easily, the limit only guards against
+//! unbounded growth when icons are requested for many sizes or resolutions
+static constexpr size_t MAX_PIXMAP_COUNT = 8192;
+
+PaletteCellIconCache* PaletteCellIconCache::instance()
+{
+    static PaletteCellIconCache c;
+    return &c;
+}
+
+void PaletteCellIconCache::init()
+{
+    configuration()->colorsChanged().onNotify(this, [this]() {
+        clear();
+    });
+}
+
+bool PaletteCellIconCache::Key::operator<(const Key& other) const
+{
+    return std::tie(cellId, element, spatium, xoffset, yoffset, drawStaff, dpi, devicePixelRatio, width, height, selected, current)
+           < std::tie(other.cellId, other.element, other.spatium, other.xoffset, other.yoffset, other.drawStaff, other.dpi,
+                      other.devicePixelRatio, other.width, other.height, other.selected, other.current);
+}
+
+QPixmap PaletteCellIconCache::pixmap(const Key& key) const
+{
+    auto it = m_pixmaps.find(key);
+    if (it == m_pixmaps.end()) {
+        ++m_misses;
+        return QPixmap();
+    }
+
+    ++m_hits;
+    return it->second;
+}
+
+void PaletteCellIconCache::insert(const Key& key, const QPixmap& pixmap)
+{
+    if (m_pixmaps.size() >= MAX_PIXMAP_COUNT) {
+        m_pixmaps.clear();
+    }
+
+    m_pixmaps[key] = pixmap;
+}
+
+void PaletteCellIconCache::invalidate(const QString& cellId)
+{
+    for (auto it = m_pixmaps.begin(); it != m_pixmaps.end();) {
+        if (it->first.cellId == cellId) {
+            it = m_pixmaps.erase(it);
+        } else {
+            ++it;
+        }
+    }
+}
+
+void PaletteCellIconCache::clear()
+{
+    m_pixmaps.clear();
+}
+
+std::string PaletteCellIconCache::statistic() const
+{
+    const size_t requests = m_hits + m_misses;
+    const double hitRate = requests > 0 ? 100.0 * m_hits / requests : 0.0;
+
+    std::stringstream ss;
+    ss << "icons: " << m_pixmaps.size()
+       << ", hits: " << m_hits
+       << ", misses: " << m_misses
+       << ", hit rate: " << hitRate << "%";
+
+    return ss.str();
+}
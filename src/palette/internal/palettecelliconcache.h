@@ -0,0 +1,84 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2023 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#ifndef MU_PALETTE_PALETTECELLICONCACHE_H
+#define MU_PALETTE_PALETTECELLICONCACHE_H
+
+#include <map>
+#include <string>
+
+#include <QPixmap>
+#include <QString>
+
+#include "async/asyncable.h"
+#include "modularity/ioc.h"
+#include "ipaletteconfiguration.h"
+
+namespace mu::palette {
+//! NOTE Rendered palette cell icons.
+//! Painting a cell lays out and draws its engraving item, which is too slow
+//! to be done every time a palette is scrolled or hovered
+class PaletteCellIconCache : public async::Asyncable
+{
+    INJECT(IPaletteConfiguration, configuration)
+
+public:
+    static PaletteCellIconCache* instance();
+
+    void init();
+
+    struct Key
+    {
+        QString cellId;
+        const void* element = nullptr;
+        qreal spatium = 0.0;
+        qreal xoffset = 0.0;
+        qreal yoffset = 0.0;
+        bool drawStaff = false;
+        qreal dpi = 0.0;
+        qreal devicePixelRatio = 1.0;
+        int width = 0;
+        int height = 0;
+        bool selected = false;
+        bool current = false;
+
+        bool operator<(const Key& other) const;
+    };
+
+    QPixmap pixmap(const Key& key) const;
+    void insert(const Key& key, const QPixmap& pixmap);
+
+    void invalidate(const QString& cellId);
+    void clear();
+
+    std::string statistic() const;
+
+private:
+    PaletteCellIconCache() = default;
+
+    std::map<Key, QPixmap> m_pixmaps;
+
+    mutable size_t m_hits = 0;
+    mutable size_t m_misses = 0;
+};
+}
+
+#endif // MU_PALETTE_PALETTECELLICONCACHE_H
@@ -23,6 +23,8 @@
 
 #include <QPainter>
 
+#include "palettecelliconcache.h"
+
 #include "draw/types/geometry.h"
 #include "draw/painter.h"
 #include "draw/types/pen.h"
@@ -49,12 +51,47 @@ QIconEngine* PaletteCellIconEngine::clone() const
 
 void PaletteCellIconEngine::paint(QPainter* qp, const QRect& rect, QIcon::Mode mode, QIcon::State state)
 {
-    qreal dpi = qp->device()->logicalDpiX();
-    Painter p(qp, "palettecell");
-    p.save();
-    p.setAntialiasing(true);
-    paintCell(p, RectF::fromQRectF(rect), mode == QIcon::Selected, state == QIcon::On, dpi);
-    p.restore();
+    const qreal dpi = qp->device()->logicalDpiX();
+    const qreal devicePixelRatio = qp->device()->devicePixelRatioF();
+    const bool selected = mode == QIcon::Selected;
+    const bool current = state == QIcon::On;
+
+    PaletteCellIconCache::Key key;
+    key.spatium = configuration()->paletteSpatium() * m_extraMag;
+    if (m_cell) {
+        key.cellId = m_cell->id;
+        key.element = m_cell->element.get();
+        key.spatium *= m_cell->mag;
+        key.xoffset = m_cell->xoffset;
+        key.yoffset = m_cell->yoffset;
+        key.drawStaff = m_cell->drawStaff;
+    }
+    key.dpi = dpi;
+    key.devicePixelRatio = devicePixelRatio;
+    key.width = rect.width();
+    key.height = rect.height();
+    key.selected = selected;
+    key.current = current;
+
+    PaletteCellIconCache* cache = PaletteCellIconCache::instance();
+    QPixmap pixmap = cache->pixmap(key);
+
+    if (pixmap.isNull()) {
+        pixmap = QPixmap(rect.size() * devicePixelRatio);
+        pixmap.setDevicePixelRatio(devicePixelRatio);
+        pixmap.fill(Qt::transparent);
+
+        {
+            QPainter pixmapPainter(&pixmap);
+            Painter p(&pixmapPainter, "palettecell");
+            p.setAntialiasing(true);
+            paintCell(p, RectF(0.0, 0.0, rect.width(), rect.height()), selected, current, dpi);
+        }
+
+        cache->insert(key, pixmap);
+    }
+
+    qp->drawPixmap(rect.topLeft(), pixmap);
 }
 
 void PaletteCellIconEngine::paintCell(Painter& painter, const RectF& rect, bool selected, bool current, qreal dpi) const
@@ -30,6 +30,7 @@
 #include "ui/iinteractiveuriregister.h"
 #include "ui/iuiactionsregister.h"
 #include "accessibility/iqaccessibleinterfaceregister.h"
+#include "diagnostics/idiagnosticscountersregister.h"
 
 #include "internal/paletteconfiguration.h"
 #include "internal/paletteuiactions.h"
@@ -37,6 +38,7 @@
 #include "internal/paletteworkspacesetup.h"
 #include "internal/paletteprovider.h"
 #include "internal/palettecell.h"
+#include "internal/palettecelliconcache.h"
 
 #include "view/paletterootmodel.h"
 #include "view/palettepropertiesmodel.h"
@@ -117,6 +119,13 @@ void PaletteModule::resolveImports()
         accr->registerInterfaceGetter("mu::palette::PaletteWidget", PaletteWidget::accessibleInterface);
         accr->registerInterfaceGetter("mu::palette::PaletteCell", PaletteCell::accessibleInterface);
     }
+
+    auto cr = ioc()->resolve<diagnostics::IDiagnosticsCountersRegister>(moduleName());
+    if (cr) {
+        cr->reg("Palette cell icon cache", []() {
+            return PaletteCellIconCache::instance()->statistic();
+        });
+    }
 }
 
 void PaletteModule::registerResources()
@@ -157,6 +166,8 @@ void PaletteModule::onInit(const framework::IApplication::RunMode& mode)
     m_actionsController->init();
     m_paletteUiActions->init();
     m_paletteProvider->init();
+
+    PaletteCellIconCache::instance()->init();
 }
 
 void PaletteModule::onAllInited(const framework::IApplication::RunMode& mode)
@@ -26,6 +26,7 @@
 
 #include "internal/palettetree.h"
 #include "internal/palettecelliconengine.h"
+#include "internal/palettecelliconcache.h"
 
 #include "engraving/dom/actionicon.h"
 #include "engraving/dom/beam.h"
@@ -472,6 +473,7 @@ bool PaletteTreeModel::setData(const QModelIndex& index, const QVariant& value,
             if (!newCell) {
                 return false;
             }
+            PaletteCellIconCache::instance()->invalidate(cell->id);
             cell->element = newCell->element;
             cell->untranslatedElement = newCell->untranslatedElement;
             cell->name = newCell->name;
@@ -509,6 +511,7 @@ bool PaletteTreeModel::setData(const QModelIndex& index, const QVariant& value,
                     return false;
                 }
 
+                PaletteCellIconCache::instance()->invalidate(cell->id);
                 cell->element = newCell->element;
                 cell->untranslatedElement = newCell->untranslatedElement;
                 cell->name = newCell->name;
@@ -517,6 +520,7 @@ bool PaletteTreeModel::setData(const QModelIndex& index, const QVariant& value,
                 const QByteArray elementMimeData = map[mu::commonscene::MIME_SYMBOL_FORMAT].toByteArray();
                 PaletteCellPtr newCell = PaletteCell::fromElementMimeData(elementMimeData);
 
+                PaletteCellIconCache::instance()->invalidate(cell->id);
                 cell->element = newCell->element;
                 cell->untranslatedElement = newCell->untranslatedElement;
                 cell->name = newCell->name;